@@ -0,0 +1,336 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_c_api_overhead.cpp
+ * Per-call overhead of the C wrapper. Every C entry point is timed against the
+ * equivalent call of the C++ API on its own copy of a tiny CPU model, and the
+ * difference in nanoseconds per call is compared with a checked-in baseline.
+ *
+ * Usage: ie_c_api_overhead [-m model.xml] [-d device (CPU)] [-n iterations (20000)]
+ *                          [-baseline file] [-tolerance fraction (0.25)] [-write_baseline file]
+ * Without -m the single ReLU model IE_MOCK_MODEL_XML of ie_mock_plugin.h is read from memory.
+ * The exit code is 1 when an overhead exceeds its baseline by more than the tolerance. A baseline
+ * with no measurements reports "no baseline" and compares nothing.
+ * -write_baseline records the configuration of the run (CPU, device, Inference Engine build,
+ * compiler, model) in the file, and a check on a different configuration warns about it.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <inference_engine.hpp>
+#include "ie_c_api.h"
+#include "ie_mock_plugin.h"
+
+namespace IE = InferenceEngine;
+
+namespace {
+
+struct result {
+    std::string name;
+    double c_ns;
+    double cpp_ns;
+};
+
+/**
+ *@brief best of five runs of `iterations` calls, in nanoseconds per call. The minimum filters out preemption.
+ */
+double timeCalls(const std::function<bool()> &call, size_t iterations) {
+    double best = 0.0;
+    for (int run = 0; run < 5; ++run) {
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            if (!call()) {
+                throw std::runtime_error("call failed");
+            }
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() / iterations;
+        best = run == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+typedef std::vector<std::pair<std::string, std::string>> configuration;
+
+/**
+ *@brief the configuration the overheads are measured on. A baseline only holds for the configuration it records.
+ */
+configuration referenceConfiguration(const std::string &device, const std::string &model, size_t iterations) {
+    std::string cpu = "unknown";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        size_t colon = line.find(':');
+        if (line.compare(0, 10, "model name") == 0 && colon != std::string::npos) {
+            cpu = line.substr(line.find_first_not_of(' ', colon + 1));
+            break;
+        }
+    }
+    const IE::Version *version = IE::GetInferenceEngineVersion();
+#ifdef NDEBUG
+    const char *build = "release";
+#else
+    const char *build = "debug";
+#endif
+    return {
+        {"cpu", cpu},
+        {"device", device},
+        {"inference_engine", version && version->buildNumber ? version->buildNumber : "unknown"},
+        {"compiler", __VERSION__},
+        {"build", build},
+        {"model", model},
+        {"iterations", std::to_string(iterations)},
+    };
+}
+
+/**
+ *@brief reads the overheads of a baseline and the configuration recorded in its "# reference key: value" lines.
+ */
+std::map<std::string, double> readBaseline(const std::string &path, configuration &reference) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("cannot read " + path);
+    }
+    const std::string prefix = "# reference ";
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t colon = line.find(": ");
+        if (line.compare(0, prefix.size(), prefix) == 0 && colon != std::string::npos) {
+            reference.emplace_back(line.substr(prefix.size(), colon - prefix.size()), line.substr(colon + 2));
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string name;
+        double ns;
+        if (line.empty() || line[0] == '#' || !(fields >> name >> ns)) {
+            continue;
+        }
+        baseline[name] = ns;
+    }
+    return baseline;
+}
+
+void writeBaseline(const std::string &path, const std::vector<result> &results, const configuration &reference) {
+    std::ofstream file(path);
+    file << "# Overhead of the C wrapper over the C++ API in nanoseconds per call, written by\n"
+            "# ie_c_api_overhead -write_baseline on the reference configuration below. Regenerate\n"
+            "# it on the same configuration after an intended change of the overhead.\n";
+    for (const auto &entry : reference) {
+        file << "# reference " << entry.first << ": " << entry.second << "\n";
+    }
+    for (const auto &r : results) {
+        char line[128];
+        snprintf(line, sizeof(line), "%-24s %.0f\n", r.name.c_str(), std::max(0.0, r.c_ns - r.cpp_ns));
+        file << line;
+    }
+    if (!file) {
+        throw std::runtime_error("cannot write " + path);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::string model, device = "CPU", baseline_path, write_path;
+    size_t iterations = 20000;
+    double tolerance = 0.25;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "-m") {
+            model = argv[i + 1];
+        } else if (arg == "-d") {
+            device = argv[i + 1];
+        } else if (arg == "-n") {
+            iterations = std::max(1L, atol(argv[i + 1]));
+        } else if (arg == "-baseline") {
+            baseline_path = argv[i + 1];
+        } else if (arg == "-tolerance") {
+            tolerance = atof(argv[i + 1]);
+        } else if (arg == "-write_baseline") {
+            write_path = argv[i + 1];
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    configuration current = referenceConfiguration(device, model.empty() ? "IE_MOCK_MODEL_XML" : model,
+                                                   iterations);
+    std::vector<result> results;
+    ie_core_t *core = nullptr;
+    ie_network_t *network = nullptr;
+    ie_executable_network_t *exe_network = nullptr;
+    ie_infer_request_t *request = nullptr;
+    ie_blob_t *input_blob = nullptr;
+    char *input_name = nullptr;
+    int status = 0;
+    try {
+        ie_config_t config = {nullptr, nullptr, nullptr};
+        if (ie_core_create("", &core) != OK) {
+            throw std::runtime_error("failed to create the core");
+        }
+        bool read = model.empty() ?
+            ie_core_read_network_from_memory(core, reinterpret_cast<const uint8_t *>(IE_MOCK_MODEL_XML),
+                                             strlen(IE_MOCK_MODEL_XML), nullptr, &network) == OK :
+            ie_core_read_network(core, model.c_str(), nullptr, &network) == OK;
+        if (!read ||
+            ie_network_get_input_name(network, 0, &input_name) != OK ||
+            ie_core_load_network(core, network, device.c_str(), &config, &exe_network) != OK ||
+            ie_exec_network_create_infer_request(exe_network, &request) != OK ||
+            ie_infer_request_get_blob(request, input_name, &input_blob) != OK) {
+            throw std::runtime_error("failed to load " + (model.empty() ? "the built-in model" : model) + " through the C API");
+        }
+
+        IE::Core ie;
+        IE::CNNNetwork cnn_network = model.empty() ? ie.ReadNetwork(IE_MOCK_MODEL_XML, IE::Blob::CPtr()) : ie.ReadNetwork(model);
+        IE::ExecutableNetwork cpp_exe_network = ie.LoadNetwork(cnn_network, device);
+        IE::InferRequest cpp_request = cpp_exe_network.CreateInferRequest();
+        std::string name = input_name;
+        IE::Blob::Ptr cpp_input_blob = cpp_request.GetBlob(name);
+        IE::TensorDesc desc = cpp_input_blob->getTensorDesc();
+        tensor_desc_t c_desc;
+        if (ie_blob_get_layout(input_blob, &c_desc.layout) != OK || ie_blob_get_dims(input_blob, &c_desc.dims) != OK ||
+            ie_blob_get_precision(input_blob, &c_desc.precision) != OK) {
+            throw std::runtime_error("failed to get the input description");
+        }
+        std::memset(cpp_input_blob->buffer(), 0, cpp_input_blob->byteSize());
+        ie_blob_buffer_t buffer;
+        if (ie_blob_get_buffer(input_blob, &buffer) != OK) {
+            throw std::runtime_error("failed to map the input");
+        }
+        std::memset(buffer.buffer, 0, cpp_input_blob->byteSize());
+
+        auto measure = [&](const char *case_name, const std::function<bool()> &c_call, const std::function<bool()> &cpp_call,
+                           size_t n) {
+            result r{case_name, timeCalls(c_call, n), timeCalls(cpp_call, n)};
+            results.push_back(r);
+        };
+
+        measure("blob_make_memory", [&] {
+            ie_blob_t *blob = nullptr;
+            bool ok = ie_blob_make_memory(&c_desc, &blob) == OK;
+            ie_blob_free(&blob);
+            return ok;
+        }, [&] {
+            IE::Blob::Ptr blob = IE::make_shared_blob<float>(desc);
+            blob->allocate();
+            return static_cast<bool>(blob);
+        }, iterations);
+        measure("infer_request_get_blob", [&] {
+            ie_blob_t *blob = nullptr;
+            bool ok = ie_infer_request_get_blob(request, input_name, &blob) == OK;
+            ie_blob_free(&blob);
+            return ok;
+        }, [&] {
+            return static_cast<bool>(cpp_request.GetBlob(name));
+        }, iterations);
+        measure("infer_request_set_blob", [&] {
+            return ie_infer_request_set_blob(request, input_name, input_blob) == OK;
+        }, [&] {
+            cpp_request.SetBlob(name, cpp_input_blob);
+            return true;
+        }, iterations);
+        measure("infer_request_infer", [&] {
+            return ie_infer_request_infer(request) == OK;
+        }, [&] {
+            cpp_request.Infer();
+            return true;
+        }, std::max<size_t>(iterations / 20, 1));
+        measure("network_inputs_number", [&] {
+            size_t size = 0;
+            return ie_network_get_inputs_number(network, &size) == OK && size == 1;
+        }, [&] {
+            return cnn_network.getInputsInfo().size() == 1;
+        }, iterations);
+        measure("network_input_name", [&] {
+            char *c_name = nullptr;
+            bool ok = ie_network_get_input_name(network, 0, &c_name) == OK;
+            ie_network_name_free(&c_name);
+            return ok;
+        }, [&] {
+            IE::InputsDataMap inputs = cnn_network.getInputsInfo();
+            std::string cpp_name = inputs.begin()->first;
+            return !cpp_name.empty();
+        }, iterations);
+        measure("network_input_precision", [&] {
+            precision_e precision;
+            return ie_network_get_input_precision(network, input_name, &precision) == OK;
+        }, [&] {
+            IE::InputsDataMap inputs = cnn_network.getInputsInfo();
+            return inputs.find(name)->second->getPrecision() == IE::Precision::FP32;
+        }, iterations);
+        measure("network_input_dims", [&] {
+            dimensions_t dims;
+            return ie_network_get_input_dims(network, input_name, &dims) == OK;
+        }, [&] {
+            IE::InputsDataMap inputs = cnn_network.getInputsInfo();
+            return inputs.find(name)->second->getTensorDesc().getDims().size() == 4;
+        }, iterations);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        status = 1;
+    }
+    ie_blob_free(&input_blob);
+    ie_infer_request_free(&request);
+    ie_exec_network_free(&exe_network);
+    ie_network_name_free(&input_name);
+    ie_network_free(&network);
+    ie_core_free(&core);
+    if (status) {
+        return status;
+    }
+
+    std::map<std::string, double> baseline;
+    configuration reference;
+    try {
+        if (!baseline_path.empty()) {
+            baseline = readBaseline(baseline_path, reference);
+        }
+        if (!write_path.empty()) {
+            writeBaseline(write_path, results, current);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (!baseline_path.empty() && baseline.empty()) {
+        std::cerr << "no baseline: " << baseline_path << " has no measured overheads, generate it with -write_baseline "
+                     "on the reference configuration" << std::endl;
+    }
+    // overheads measured on another configuration are not comparable, say which parts differ
+    for (const auto &entry : reference) {
+        for (const auto &now : current) {
+            if (now.first == entry.first && now.first != "iterations" && now.second != entry.second) {
+                std::cerr << "warning: baseline " << entry.first << " is \"" << entry.second << "\", measured on \""
+                          << now.second << "\"" << std::endl;
+            }
+        }
+    }
+
+    printf("%-24s %12s %12s %14s %12s\n", "entry point", "C ns/call", "C++ ns/call", "overhead ns", "baseline ns");
+    for (const auto &r : results) {
+        double overhead = r.c_ns - r.cpp_ns;
+        auto expected = baseline.find(r.name);
+        bool regressed = expected != baseline.end() && overhead > expected->second * (1.0 + tolerance);
+        printf("%-24s %12.1f %12.1f %14.1f", r.name.c_str(), r.c_ns, r.cpp_ns, overhead);
+        if (expected != baseline.end()) {
+            printf(" %12.0f%s", expected->second, regressed ? "  REGRESSION" : "");
+        }
+        printf("\n");
+        status |= regressed;
+    }
+    return status;
+}
@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_c_api_scaling.c
+ * Stress benchmark of C API entry points called concurrently from many threads.
+ * Every thread runs the same mix of blob getters and error paths against objects
+ * shared by all threads, so any shared write or lock inside the wrapper shows up as
+ * throughput per thread dropping with the number of threads. The run fails when the
+ * efficiency, the throughput per thread relative to one thread, falls below the minimum
+ * for any number of threads up to the number of online CPUs.
+ *
+ * Usage: ie_c_api_scaling [max_threads (64)] [duration_ms (1000)] [min_efficiency (0.8)] [model.xml] [device (CPU)]
+ *
+ * With a model, a second mix calls ie_infer_request_get_blob() with an unknown name on one
+ * infer request shared by all threads. The Inference Engine throws, and the wrapper converts
+ * the exception to a status, which must be the same on every call. Its efficiency is printed
+ * but not checked: unwinding an exception takes a lock inside the C++ runtime with older C
+ * libraries. Network getters such as ie_network_get_input_precision() are not measured,
+ * they copy the InputsDataMap of the network on every call, whose shared pointers count
+ * references with shared writes in the Inference Engine itself.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ie_c_api.h"
+
+typedef enum {
+    MIX_GETTERS,     // blob getters and argument checks
+    MIX_EXCEPTIONS,  // status of an exception thrown by the Inference Engine
+} mix_e;
+
+typedef struct {
+    mix_e mix;
+    const ie_blob_t *blob;
+    ie_infer_request_t *request;
+    IEStatusCode expected;
+    pthread_barrier_t *barrier;
+    atomic_int *stop;
+    unsigned long long ops;
+    unsigned long long errors;
+} worker_args_t;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *worker(void *p) {
+    worker_args_t *args = (worker_args_t *)p;
+    unsigned long long ops = 0, errors = 0;
+    precision_e prec;
+    layout_e layout;
+    dimensions_t dims;
+    ie_blob_t *blob = NULL;
+
+    pthread_barrier_wait(args->barrier);
+    while (!atomic_load_explicit(args->stop, memory_order_relaxed)) {
+        if (args->mix == MIX_GETTERS) {
+            errors += ie_blob_get_precision(args->blob, &prec) != OK;
+            errors += ie_blob_get_layout(args->blob, &layout) != OK;
+            errors += ie_blob_get_dims(args->blob, &dims) != OK;
+            // error paths must not touch shared state either
+            errors += ie_blob_get_precision(NULL, &prec) != GENERAL_ERROR;
+            ops += 4;
+        } else {
+            errors += ie_infer_request_get_blob(args->request, "not a blob", &blob) != args->expected;
+            ops += 1;
+        }
+    }
+    args->ops = ops;
+    args->errors = errors;
+    return NULL;
+}
+
+static double run(mix_e mix, int threads, int duration_ms, const ie_blob_t *blob, ie_infer_request_t *request,
+                  IEStatusCode expected, unsigned long long *errors) {
+    pthread_t *tids = (pthread_t *)calloc(threads, sizeof(pthread_t));
+    worker_args_t *args = (worker_args_t *)calloc(threads, sizeof(worker_args_t));
+    pthread_barrier_t barrier;
+    atomic_int stop;
+    struct timespec duration = {duration_ms / 1000, (duration_ms % 1000) * 1000000L};
+    unsigned long long ops = 0;
+    double begin, elapsed;
+    int i;
+
+    atomic_init(&stop, 0);
+    pthread_barrier_init(&barrier, NULL, threads + 1);
+    for (i = 0; i < threads; ++i) {
+        args[i].mix = mix;
+        args[i].blob = blob;
+        args[i].request = request;
+        args[i].expected = expected;
+        args[i].barrier = &barrier;
+        args[i].stop = &stop;
+        pthread_create(&tids[i], NULL, worker, &args[i]);
+    }
+
+    pthread_barrier_wait(&barrier);
+    begin = now_sec();
+    nanosleep(&duration, NULL);
+    atomic_store(&stop, 1);
+    for (i = 0; i < threads; ++i) {
+        pthread_join(tids[i], NULL);
+        ops += args[i].ops;
+        *errors += args[i].errors;
+    }
+    elapsed = now_sec() - begin;
+
+    pthread_barrier_destroy(&barrier);
+    free(args);
+    free(tids);
+    return ops / elapsed;
+}
+
+/**
+ * @brief runs the mix on 1, 2, 4... up to max_threads threads. Returns 1 on an unexpected status or, when
+ * min_efficiency is positive, on an efficiency below it with no more threads than CPUs.
+ */
+static int sweep(const char *title, mix_e mix, int max_threads, int duration_ms, double min_efficiency,
+                 const ie_blob_t *blob, ie_infer_request_t *request, IEStatusCode expected) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    double base = 0.0;
+    int threads, failed = 0;
+
+    printf("%s\n%8s %14s %16s %11s\n", title, "threads", "Mcalls/s", "Mcalls/s/thread", "efficiency");
+    for (threads = 1;; threads *= 2) {
+        unsigned long long errors = 0;
+        double rate, efficiency;
+        if (threads > max_threads) {
+            threads = max_threads;
+        }
+        rate = run(mix, threads, duration_ms, blob, request, expected, &errors);
+        if (threads == 1) {
+            base = rate;
+        }
+        efficiency = rate / (base * threads);
+        printf("%8d %14.2f %16.2f %10.1f%%", threads, rate * 1e-6, rate * 1e-6 / threads, 100.0 * efficiency);
+        if (min_efficiency > 0.0 && threads <= cpus && efficiency < min_efficiency) {
+            printf("  below %.1f%%", 100.0 * min_efficiency);
+            failed = 1;
+        }
+        printf("\n");
+        if (errors) {
+            fprintf(stderr, "%llu calls returned an unexpected status\n", errors);
+            return 1;
+        }
+        if (threads == max_threads) {
+            break;
+        }
+    }
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 64;
+    int duration_ms = argc > 2 ? atoi(argv[2]) : 1000;
+    double min_efficiency = argc > 3 ? atof(argv[3]) : 0.8;
+    const char *model = argc > 4 ? argv[4] : NULL;
+    const char *device = argc > 5 ? argv[5] : "CPU";
+    tensor_desc_t desc = {NCHW, {4, {1, 3, 224, 224}}, FP32};
+    ie_core_t *core = NULL;
+    ie_network_t *network = NULL;
+    ie_executable_network_t *exe_network = NULL;
+    ie_infer_request_t *request = NULL;
+    ie_blob_t *blob = NULL;
+    ie_blob_t *unknown = NULL;
+    ie_config_t config = {NULL, NULL, NULL};
+    IEStatusCode expected = OK;
+    int status;
+
+    if (max_threads < 1 || duration_ms < 1) {
+        fprintf(stderr, "Usage: %s [max_threads] [duration_ms] [min_efficiency] [model.xml] [device]\n", argv[0]);
+        return 1;
+    }
+
+    if (ie_blob_make_memory(&desc, &blob) != OK) {
+        fprintf(stderr, "Failed to create blob\n");
+        return 1;
+    }
+    if (model) {
+        if (ie_core_create("", &core) != OK || ie_core_read_network(core, model, NULL, &network) != OK ||
+            ie_core_load_network(core, network, device, &config, &exe_network) != OK ||
+            ie_exec_network_create_infer_request(exe_network, &request) != OK) {
+            fprintf(stderr, "Failed to load %s on %s\n", model, device);
+            return 1;
+        }
+        // the status the exception converts to, every concurrent call must return the same
+        expected = ie_infer_request_get_blob(request, "not a blob", &unknown);
+        if (expected == OK) {
+            fprintf(stderr, "Getting an unknown blob did not fail\n");
+            return 1;
+        }
+    }
+
+    status = sweep("blob getters and argument checks", MIX_GETTERS, max_threads, duration_ms, min_efficiency,
+                   blob, NULL, OK);
+    if (request) {
+        status |= sweep("exception converted to a status", MIX_EXCEPTIONS, max_threads, duration_ms, 0.0,
+                        NULL, request, expected);
+    }
+
+    ie_infer_request_free(&request);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+    ie_blob_free(&blob);
+    return status;
+}
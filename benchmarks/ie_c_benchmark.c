@@ -0,0 +1,491 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_c_benchmark.c
+ * Throughput and latency of a model as seen by a C consumer of the API, in the spirit of
+ * benchmark_app. In sync mode every request is driven by its own thread calling
+ * ie_infer_request_infer(); in async mode all requests run ie_infer_request_infer_async()
+ * and are restarted from their completion callback until the duration elapses.
+ *
+ * Usage: ie_c_benchmark -m model.xml [-d device (CPU)] [-api sync|async (async)] [-nireq n (4)]
+ *                       [-b batch] [-t seconds (10)] [-i input.bin|random (random)]
+ *                       [-c KEY=VALUE]... [-pc] [-json report.json]
+ * The input file holds raw data copied into every input in turn, repeated when shorter.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ie_c_api.h"
+
+#define MAX_CONFIGS 32
+
+typedef struct {
+    const char *model;
+    const char *device;
+    int async;
+    int nireq;
+    int batch;
+    double duration;
+    const char *input;
+    int perf_counts;
+    const char *json;
+    ie_config_t config[MAX_CONFIGS + 1];
+    size_t num_configs;
+    char *owned[MAX_CONFIGS];  // KEY=VALUE copies split into config entries
+    size_t num_owned;
+} options_t;
+
+typedef struct {
+    double *values;
+    size_t count;
+    size_t capacity;
+} latencies_t;
+
+typedef struct bench_request {
+    ie_infer_request_t *request;
+    ie_complete_call_back_t callback;  // referenced by the request until it is freed
+    latencies_t latencies;
+    double start;
+    double deadline;
+    int status;
+    atomic_int *in_flight;
+    pthread_mutex_t *mutex;
+    pthread_cond_t *done;
+} bench_request_t;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int add_latency(latencies_t *latencies, double ms) {
+    if (latencies->count == latencies->capacity) {
+        size_t capacity = latencies->capacity ? latencies->capacity * 2 : 4096;
+        double *values = (double *)realloc(latencies->values, capacity * sizeof(double));
+        if (values == NULL) {
+            return -1;
+        }
+        latencies->values = values;
+        latencies->capacity = capacity;
+    }
+    latencies->values[latencies->count++] = ms;
+    return 0;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+static double percentile(const double *sorted, size_t count, double p) {
+    size_t index = (size_t)(p / 100.0 * (count - 1) + 0.5);
+    return sorted[index < count ? index : count - 1];
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s -m model.xml [-d device] [-api sync|async] [-nireq n] [-b batch] [-t seconds]\n"
+                    "       [-i input.bin|random] [-c KEY=VALUE]... [-pc] [-json report.json]\n", name);
+}
+
+static int parse_options(int argc, char **argv, options_t *opt) {
+    int i;
+    memset(opt, 0, sizeof(*opt));
+    opt->device = "CPU";
+    opt->async = 1;
+    opt->nireq = 4;
+    opt->duration = 10.0;
+    opt->input = "random";
+
+    for (i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "-pc") == 0) {
+            opt->perf_counts = 1;
+            continue;
+        }
+        if (value == NULL) {
+            return -1;
+        }
+        ++i;
+        if (strcmp(arg, "-m") == 0) {
+            opt->model = value;
+        } else if (strcmp(arg, "-d") == 0) {
+            opt->device = value;
+        } else if (strcmp(arg, "-api") == 0) {
+            if (strcmp(value, "sync") != 0 && strcmp(value, "async") != 0) {
+                return -1;
+            }
+            opt->async = strcmp(value, "async") == 0;
+        } else if (strcmp(arg, "-nireq") == 0) {
+            opt->nireq = atoi(value);
+        } else if (strcmp(arg, "-b") == 0) {
+            opt->batch = atoi(value);
+        } else if (strcmp(arg, "-t") == 0) {
+            opt->duration = atof(value);
+        } else if (strcmp(arg, "-i") == 0) {
+            opt->input = value;
+        } else if (strcmp(arg, "-json") == 0) {
+            opt->json = value;
+        } else if (strcmp(arg, "-c") == 0) {
+            char *key = strdup(value);
+            char *separator = key ? strchr(key, '=') : NULL;
+            if (separator == NULL || opt->num_configs == MAX_CONFIGS) {
+                free(key);
+                return -1;
+            }
+            *separator = '\0';
+            opt->owned[opt->num_owned++] = key;
+            opt->config[opt->num_configs].name = key;
+            opt->config[opt->num_configs].value = separator + 1;
+            ++opt->num_configs;
+        } else {
+            return -1;
+        }
+    }
+    if (opt->perf_counts && opt->num_configs < MAX_CONFIGS) {
+        opt->config[opt->num_configs].name = "PERF_COUNT";
+        opt->config[opt->num_configs].value = "YES";
+        ++opt->num_configs;
+    }
+    for (i = 0; i < (int)opt->num_configs; ++i) {
+        opt->config[i].next = &opt->config[i + 1];
+    }
+    return opt->model && opt->nireq > 0 && opt->batch >= 0 && opt->duration > 0.0 ? 0 : -1;
+}
+
+static int set_batch(ie_network_t *network, int batch) {
+    input_shapes_t shapes;
+    size_t i;
+    int status;
+    if (ie_network_get_input_shapes(network, &shapes) != OK) {
+        return -1;
+    }
+    for (i = 0; i < shapes.shape_num; ++i) {
+        shapes.shapes[i].shape.dims[0] = (size_t)batch;
+    }
+    status = ie_network_reshape(network, shapes);
+    ie_network_input_shapes_free(&shapes);
+    return status == OK ? 0 : -1;
+}
+
+/**
+ * Fills every input of the request, from the input file when given and with random bytes otherwise.
+ * Random bytes stay below 0x40 so that FP32 and FP16 inputs never hold NaN or infinity.
+ */
+static int fill_inputs(ie_network_t *network, ie_infer_request_t *request, const unsigned char *data, size_t data_size) {
+    size_t num = 0, i, offset = 0;
+    if (ie_network_get_inputs_number(network, &num) != OK) {
+        return -1;
+    }
+    for (i = 0; i < num; ++i) {
+        char *name = NULL;
+        ie_blob_t *blob = NULL;
+        ie_blob_buffer_t buffer;
+        int size = 0, j;
+        if (ie_network_get_input_name(network, i, &name) != OK) {
+            return -1;
+        }
+        if (ie_infer_request_get_blob(request, name, &blob) != OK || ie_blob_get_buffer(blob, &buffer) != OK ||
+            ie_blob_byte_size(blob, &size) != OK) {
+            ie_network_name_free(&name);
+            return -1;
+        }
+        for (j = 0; j < size; ++j) {
+            if (data) {
+                ((unsigned char *)buffer.buffer)[j] = data[offset++ % data_size];
+            } else {
+                ((unsigned char *)buffer.buffer)[j] = (unsigned char)(rand() & 0x3f);
+            }
+        }
+        ie_blob_free(&blob);
+        ie_network_name_free(&name);
+    }
+    return 0;
+}
+
+static unsigned char *read_file(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    unsigned char *data = NULL;
+    long length;
+    if (file == NULL) {
+        return NULL;
+    }
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 && fseek(file, 0, SEEK_SET) == 0) {
+        data = (unsigned char *)malloc((size_t)length);
+        if (data && fread(data, 1, (size_t)length, file) != (size_t)length) {
+            free(data);
+            data = NULL;
+        }
+        *size = (size_t)length;
+    }
+    fclose(file);
+    return data;
+}
+
+static void *sync_worker(void *p) {
+    bench_request_t *req = (bench_request_t *)p;
+    double begin, end;
+    do {
+        begin = now_sec();
+        if (ie_infer_request_infer(req->request) != OK) {
+            req->status = -1;
+            break;
+        }
+        end = now_sec();
+        if (add_latency(&req->latencies, (end - begin) * 1000.0) != 0) {
+            req->status = -1;
+            break;
+        }
+    } while (end < req->deadline);
+    return NULL;
+}
+
+static void finish_request(bench_request_t *req) {
+    pthread_mutex_lock(req->mutex);
+    if (atomic_fetch_sub(req->in_flight, 1) == 1) {
+        pthread_cond_signal(req->done);
+    }
+    pthread_mutex_unlock(req->mutex);
+}
+
+static void completion_callback(void *p) {
+    bench_request_t *req = (bench_request_t *)p;
+    double end = now_sec();
+    if (add_latency(&req->latencies, (end - req->start) * 1000.0) != 0) {
+        req->status = -1;
+    }
+    if (req->status == 0 && end < req->deadline) {
+        req->start = now_sec();
+        if (ie_infer_request_infer_async(req->request) == OK) {
+            return;
+        }
+        req->status = -1;
+    }
+    finish_request(req);
+}
+
+static int run(bench_request_t *requests, int nireq, int async, double duration) {
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t done = PTHREAD_COND_INITIALIZER;
+    atomic_int in_flight;
+    double deadline = now_sec() + duration;
+    int i, status = 0;
+
+    atomic_init(&in_flight, nireq);
+    if (!async) {
+        pthread_t *tids = (pthread_t *)calloc(nireq, sizeof(pthread_t));
+        for (i = 0; i < nireq; ++i) {
+            requests[i].deadline = deadline;
+            pthread_create(&tids[i], NULL, sync_worker, &requests[i]);
+        }
+        for (i = 0; i < nireq; ++i) {
+            pthread_join(tids[i], NULL);
+            status |= requests[i].status;
+        }
+        free(tids);
+        return status;
+    }
+
+    for (i = 0; i < nireq; ++i) {
+        requests[i].callback.completeCallBackFunc = completion_callback;
+        requests[i].callback.args = &requests[i];
+        requests[i].deadline = deadline;
+        requests[i].in_flight = &in_flight;
+        requests[i].mutex = &mutex;
+        requests[i].done = &done;
+        if (ie_infer_set_completion_callback(requests[i].request, &requests[i].callback) != OK) {
+            return -1;
+        }
+    }
+    for (i = 0; i < nireq; ++i) {
+        requests[i].start = now_sec();
+        if (ie_infer_request_infer_async(requests[i].request) != OK) {
+            requests[i].status = -1;
+            finish_request(&requests[i]);
+        }
+    }
+    pthread_mutex_lock(&mutex);
+    while (atomic_load(&in_flight) > 0) {
+        pthread_cond_wait(&done, &mutex);
+    }
+    pthread_mutex_unlock(&mutex);
+    for (i = 0; i < nireq; ++i) {
+        // lets callbacks still returning into the runtime finish before the requests are reused or freed
+        status |= ie_infer_request_wait(requests[i].request, -1) == OK ? requests[i].status : -1;
+    }
+    return status;
+}
+
+static void json_string(FILE *file, const char *str) {
+    fputc('"', file);
+    for (; str && *str; ++str) {
+        if (*str == '"' || *str == '\\') {
+            fprintf(file, "\\%c", *str);
+        } else if ((unsigned char)*str < 0x20) {
+            fprintf(file, "\\u%04x", *str);
+        } else {
+            fputc(*str, file);
+        }
+    }
+    fputc('"', file);
+}
+
+static const char *layer_status_name(layer_status_e status) {
+    return status == LAYER_EXECUTED ? "EXECUTED" : status == LAYER_OPTIMIZED_OUT ? "OPTIMIZED_OUT" : "NOT_RUN";
+}
+
+int main(int argc, char **argv) {
+    options_t opt;
+    ie_core_t *core = NULL;
+    ie_network_t *network = NULL;
+    ie_executable_network_t *exe_network = NULL;
+    bench_request_t *requests = NULL;
+    ie_profiling_infos_t perf_counts = {NULL, 0};
+    unsigned char *data = NULL;
+    size_t data_size = 0, count = 0, i, j;
+    double *latencies = NULL, begin, elapsed, load_ms, sum = 0.0;
+    double p50, p90, p99;
+    int batch = 1, status = 1;
+
+    if (parse_options(argc, argv, &opt) != 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (strcmp(opt.input, "random") != 0 && (data = read_file(opt.input, &data_size)) == NULL) {
+        fprintf(stderr, "Failed to read %s\n", opt.input);
+        return 1;
+    }
+
+    if (ie_core_create("", &core) != OK || ie_core_read_network(core, opt.model, NULL, &network) != OK) {
+        fprintf(stderr, "Failed to read %s\n", opt.model);
+        goto cleanup;
+    }
+    if (opt.batch > 0) {
+        if (set_batch(network, opt.batch) != 0) {
+            fprintf(stderr, "Failed to reshape %s to batch %d\n", opt.model, opt.batch);
+            goto cleanup;
+        }
+        batch = opt.batch;
+    }
+    begin = now_sec();
+    if (ie_core_load_network(core, network, opt.device, opt.config, &exe_network) != OK) {
+        fprintf(stderr, "Failed to load %s on %s\n", opt.model, opt.device);
+        goto cleanup;
+    }
+    load_ms = (now_sec() - begin) * 1000.0;
+
+    requests = (bench_request_t *)calloc(opt.nireq, sizeof(bench_request_t));
+    for (i = 0; i < (size_t)opt.nireq; ++i) {
+        if (ie_exec_network_create_infer_request(exe_network, &requests[i].request) != OK ||
+            fill_inputs(network, requests[i].request, data, data_size) != 0) {
+            fprintf(stderr, "Failed to create infer request %zu\n", i);
+            goto cleanup;
+        }
+    }
+    // the first inference pays for lazy allocations, keep it out of the statistics
+    if (ie_infer_request_infer(requests[0].request) != OK) {
+        fprintf(stderr, "Inference failed\n");
+        goto cleanup;
+    }
+
+    begin = now_sec();
+    if (run(requests, opt.nireq, opt.async, opt.duration) != 0) {
+        fprintf(stderr, "Inference failed\n");
+        goto cleanup;
+    }
+    elapsed = now_sec() - begin;
+
+    for (i = 0; i < (size_t)opt.nireq; ++i) {
+        count += requests[i].latencies.count;
+    }
+    latencies = (double *)malloc((count ? count : 1) * sizeof(double));
+    for (i = 0, count = 0; i < (size_t)opt.nireq; ++i) {
+        for (j = 0; j < requests[i].latencies.count; ++j) {
+            sum += latencies[count++] = requests[i].latencies.values[j];
+        }
+    }
+    if (count == 0) {
+        fprintf(stderr, "No inference completed\n");
+        goto cleanup;
+    }
+    qsort(latencies, count, sizeof(double), compare_double);
+    p50 = percentile(latencies, count, 50.0);
+    p90 = percentile(latencies, count, 90.0);
+    p99 = percentile(latencies, count, 99.0);
+    if (opt.perf_counts && ie_infer_request_get_performance_counts(requests[0].request, &perf_counts) != OK) {
+        fprintf(stderr, "Failed to get performance counters\n");
+        goto cleanup;
+    }
+
+    printf("Model:        %s\n", opt.model);
+    printf("Device:       %s, %s API, %d requests, batch %d\n", opt.device, opt.async ? "async" : "sync", opt.nireq, batch);
+    printf("Load time:    %.2f ms\n", load_ms);
+    printf("Inferences:   %zu in %.3f s\n", count, elapsed);
+    printf("Throughput:   %.2f FPS\n", count * batch / elapsed);
+    printf("Latency ms:   min %.3f  avg %.3f  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n",
+           latencies[0], sum / count, p50, p90, p99, latencies[count - 1]);
+    if (perf_counts.num_infos) {
+        printf("\n%-40s %-14s %-20s %12s %12s\n", "layer", "status", "exec type", "real us", "cpu us");
+        for (i = 0; i < perf_counts.num_infos; ++i) {
+            const ie_profiling_info_t *info = &perf_counts.infos[i];
+            printf("%-40s %-14s %-20s %12lld %12lld\n", info->layer_name, layer_status_name(info->status),
+                   info->exec_type, info->real_time_us, info->cpu_time_us);
+        }
+    }
+
+    if (opt.json) {
+        FILE *file = fopen(opt.json, "w");
+        if (file == NULL) {
+            fprintf(stderr, "Failed to write %s\n", opt.json);
+            goto cleanup;
+        }
+        fprintf(file, "{\n  \"model\": ");
+        json_string(file, opt.model);
+        fprintf(file, ",\n  \"device\": ");
+        json_string(file, opt.device);
+        fprintf(file, ",\n  \"api\": \"%s\",\n  \"nireq\": %d,\n  \"batch\": %d,\n", opt.async ? "async" : "sync", opt.nireq, batch);
+        fprintf(file, "  \"load_ms\": %.3f,\n  \"duration_s\": %.3f,\n  \"inferences\": %zu,\n  \"throughput_fps\": %.3f,\n",
+                load_ms, elapsed, count, count * batch / elapsed);
+        fprintf(file, "  \"latency_ms\": {\"min\": %.3f, \"avg\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f},\n",
+                latencies[0], sum / count, p50, p90, p99, latencies[count - 1]);
+        fprintf(file, "  \"layers\": [");
+        for (i = 0; i < perf_counts.num_infos; ++i) {
+            const ie_profiling_info_t *info = &perf_counts.infos[i];
+            fprintf(file, "%s\n    {\"name\": ", i ? "," : "");
+            json_string(file, info->layer_name);
+            fprintf(file, ", \"type\": ");
+            json_string(file, info->layer_type);
+            fprintf(file, ", \"exec_type\": ");
+            json_string(file, info->exec_type);
+            fprintf(file, ", \"status\": \"%s\", \"real_us\": %lld, \"cpu_us\": %lld}",
+                    layer_status_name(info->status), info->real_time_us, info->cpu_time_us);
+        }
+        fprintf(file, "%s]\n}\n", perf_counts.num_infos ? "\n  " : "");
+        fclose(file);
+    }
+    status = 0;
+
+cleanup:
+    ie_profiling_infos_free(&perf_counts);
+    free(latencies);
+    for (i = 0; requests && i < (size_t)opt.nireq; ++i) {
+        ie_infer_request_free(&requests[i].request);
+        free(requests[i].latencies.values);
+    }
+    free(requests);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+    free(data);
+    for (i = 0; i < opt.num_owned; ++i) {
+        free(opt.owned[i]);
+    }
+    return status;
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_dyn_batch.c
+ * Latency/throughput tradeoff of dynamic batching. The model is loaded once with
+ * ie_core_load_network_dyn_batch() and one infer request runs every batch size from
+ * 1 to max_batch for the given duration, so the numbers differ only by the batch.
+ *
+ * Usage: ie_dyn_batch model.xml [device (CPU)] [max_batch (8)] [duration_ms (1000)]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ie_c_api.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int zero_inputs(ie_network_t *network, ie_infer_request_t *request) {
+    size_t num = 0, i;
+    if (ie_network_get_inputs_number(network, &num) != OK) {
+        return -1;
+    }
+    for (i = 0; i < num; ++i) {
+        char *name = NULL;
+        ie_blob_t *blob = NULL;
+        ie_blob_buffer_t buffer;
+        int size = 0;
+        if (ie_network_get_input_name(network, i, &name) != OK) {
+            return -1;
+        }
+        if (ie_infer_request_get_blob(request, name, &blob) != OK || ie_blob_get_buffer(blob, &buffer) != OK ||
+            ie_blob_byte_size(blob, &size) != OK) {
+            ie_network_name_free(&name);
+            return -1;
+        }
+        memset(buffer.buffer, 0, (size_t)size);
+        ie_blob_free(&blob);
+        ie_network_name_free(&name);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *model = argc > 1 ? argv[1] : NULL;
+    const char *device = argc > 2 ? argv[2] : "CPU";
+    int max_batch = argc > 3 ? atoi(argv[3]) : 8;
+    int duration_ms = argc > 4 ? atoi(argv[4]) : 1000;
+    ie_config_t config = {NULL, NULL, NULL};
+    ie_core_t *core = NULL;
+    ie_network_t *network = NULL;
+    ie_executable_network_t *exe_network = NULL;
+    ie_infer_request_t *request = NULL;
+    int batch;
+
+    if (model == NULL || max_batch < 1 || duration_ms < 1) {
+        fprintf(stderr, "Usage: %s model.xml [device] [max_batch] [duration_ms]\n", argv[0]);
+        return 1;
+    }
+
+    if (ie_core_create("", &core) != OK || ie_core_read_network(core, model, NULL, &network) != OK) {
+        fprintf(stderr, "Failed to read %s\n", model);
+        return 1;
+    }
+    if (ie_core_load_network_dyn_batch(core, network, device, &config, (size_t)max_batch, &exe_network) != OK ||
+        ie_exec_network_create_infer_request(exe_network, &request) != OK || zero_inputs(network, request) != 0) {
+        fprintf(stderr, "Failed to load %s on %s with dynamic batching\n", model, device);
+        return 1;
+    }
+
+    printf("%6s %12s %14s %16s\n", "batch", "latency ms", "inferences/s", "items/s");
+    for (batch = 1; batch <= max_batch; ++batch) {
+        double begin, elapsed, latency_ms;
+        long count = 0;
+        if (ie_infer_request_set_batch(request, (size_t)batch) != OK || ie_infer_request_infer(request) != OK) {
+            fprintf(stderr, "Inference failed at batch %d\n", batch);
+            return 1;
+        }
+
+        begin = now_sec();
+        do {
+            if (ie_infer_request_infer(request) != OK) {
+                fprintf(stderr, "Inference failed at batch %d\n", batch);
+                return 1;
+            }
+            ++count;
+            elapsed = now_sec() - begin;
+        } while (elapsed * 1000.0 < duration_ms);
+
+        latency_ms = elapsed * 1000.0 / count;
+        printf("%6d %12.3f %14.1f %16.1f\n", batch, latency_ms, count / elapsed, count * batch / elapsed);
+    }
+
+    ie_infer_request_free(&request);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+    return 0;
+}
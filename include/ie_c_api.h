@@ -49,6 +49,8 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_config_handle ie_config_handle_t;
+typedef struct ie_weights ie_weights_t;
 
 /**
  * @struct ie_version
@@ -89,6 +91,110 @@ typedef struct ie_config {
     struct ie_config *next;
 }ie_config_t;
 
+/**
+ * @struct ie_config_pair
+ * @brief Represents one configuration key and its value
+ */
+typedef struct ie_config_pair {
+    const char *name;
+    const char *value;
+}ie_config_pair_t;
+
+/**
+ * @enum autotune_goal_e
+ * @brief Objectives that the auto-tuner can optimize for
+ */
+typedef enum {
+    MAX_THROUGHPUT = 0,     // highest number of inferences per second
+    LATENCY_UNDER_SLO = 1,  // highest throughput with p99 latency not above the SLO
+}autotune_goal_e;
+
+/**
+ * @struct ie_autotune_objective
+ * @brief Represents what the auto-tuner optimizes and where the result is stored.
+ */
+typedef struct ie_autotune_objective {
+    autotune_goal_e goal;
+    double latency_slo_ms;     // p99 latency bound used by LATENCY_UNDER_SLO
+    const char *persist_path;  // optional file to store the best configuration, can be NULL
+}ie_autotune_objective_t;
+
+/**
+ * @struct ie_autotune_report
+ * @brief Represents measurements of the best configuration found by the auto-tuner.
+ */
+typedef struct ie_autotune_report {
+    size_t num_requests;   // number of infer requests to run in parallel
+    size_t num_trials;     // number of configurations measured
+    double throughput;     // inferences per second
+    double p50_latency_ms;
+    double p99_latency_ms;
+}ie_autotune_report_t;
+
+/**
+ * @struct ie_weights_memory
+ * @brief Represents memory of weights shared by several networks.
+ */
+typedef struct ie_weights_memory {
+    size_t mapped_bytes;     // size of the weights, mapped once for all networks
+    size_t resident_bytes;   // part of the weights currently in physical memory
+    size_t num_users;        // networks and executable networks referencing the weights
+}ie_weights_memory_t;
+
+/**
+ * @enum warmup_fill_e
+ * @brief Data written to the inputs of warm-up inferences
+ */
+typedef enum {
+    WARMUP_FILL_ZEROS = 0,   // all input bytes set to zero
+    WARMUP_FILL_RANDOM = 1,  // random values valid for the input precision
+}warmup_fill_e;
+
+/**
+ * @struct ie_warmup_report
+ * @brief Represents latencies measured while warming up an executable network.
+ */
+typedef struct ie_warmup_report {
+    size_t num_requests;       // number of infer requests run in parallel
+    size_t num_inferences;     // total number of inferences run
+    double first_latency_ms;   // average latency of the first round
+    double last_latency_ms;    // average latency of the last round
+    double total_ms;           // duration of the whole warm-up
+}ie_warmup_report_t;
+
+/**
+ * @enum layer_status_e
+ * @brief Execution status of a layer.
+ */
+typedef enum {
+    LAYER_NOT_RUN = 0,
+    LAYER_OPTIMIZED_OUT = 1,
+    LAYER_EXECUTED = 2,
+}layer_status_e;
+
+/**
+ * @struct ie_profiling_info
+ * @brief Represents performance counters of one layer from the last inference.
+ */
+typedef struct ie_profiling_info {
+    const char *layer_name;
+    const char *layer_type;
+    const char *exec_type;    // implementation chosen by the plugin
+    layer_status_e status;
+    long long real_time_us;   // wall time of the layer
+    long long cpu_time_us;    // cpu time of the layer
+    unsigned int execution_index;
+}ie_profiling_info_t;
+
+/**
+ * @struct ie_profiling_infos
+ * @brief Represents performance counters of all layers of an infer request.
+ */
+typedef struct ie_profiling_infos {
+    ie_profiling_info_t *infos;
+    size_t num_infos;
+}ie_profiling_infos_t;
+
 /**
  * @struct ie_param
  * @brief metric and config parameters.
@@ -102,6 +208,45 @@ typedef struct ie_param {
     };
 }ie_param_t;
 
+/**
+ * @enum param_type_e
+ * @brief Types of the value held by ie_param_v2_t
+ */
+typedef enum {
+    PARAM_EMPTY = 0,
+    PARAM_STRING,       // string
+    PARAM_STRING_LIST,  // string_list.items[0 .. string_list.num)
+    PARAM_UINT,         // uint_value
+    PARAM_INT,          // int_value
+    PARAM_FLOAT,        // float_value
+    PARAM_BOOL,         // bool_value, 0 or 1
+    PARAM_UINT_TUPLE,   // tuple.values[0 .. tuple.num), e.g. RANGE_FOR_STREAMS or RANGE_FOR_ASYNC_INFER_REQUESTS
+}param_type_e;
+
+/**
+ * @struct ie_param_v2
+ * @brief Metric and config parameter tagged with the type of its value.
+ * Use the ie_param_v2_free() method to free memory.
+ */
+typedef struct ie_param_v2 {
+    param_type_e type;
+    union {
+    char *string;
+    struct {
+        char **items;
+        size_t num;
+    } string_list;
+    uint64_t uint_value;
+    int64_t int_value;
+    double float_value;
+    int bool_value;
+    struct {
+        unsigned int values[3];
+        size_t num;
+    } tuple;
+    };
+}ie_param_v2_t;
+
 /**
  * @struct ie_param_config
  * @brief Represents configuration parameter information
@@ -215,6 +360,29 @@ typedef enum {
     RESIZE_AREA
 }resize_alg_e;
 
+/**
+ * @struct ie_port_spec
+ * @brief Represents the settings applied to one input or output of a network before it is loaded.
+ */
+typedef struct ie_port_spec {
+    const char *name;            // name of the port, NULL applies the settings to every input or output
+    precision_e precision;       // UNSPECIFIED or MIXED keeps the precision of the IR
+    layout_e layout;             // ANY keeps the layout of the IR
+    resize_alg_e resize_alg;     // inputs only, NO_RESIZE keeps the default
+    colorformat_e color_format;  // inputs only, RAW keeps the default
+}ie_port_spec_t;
+
+/**
+ * @struct ie_preprocess_spec
+ * @brief Represents the settings applied to the inputs and outputs of a network before it is loaded.
+ */
+typedef struct ie_preprocess_spec {
+    const ie_port_spec_t *inputs;
+    size_t num_inputs;
+    const ie_port_spec_t *outputs;
+    size_t num_outputs;
+}ie_preprocess_spec_t;
+
 /**
  * @enum IEStatusCode
  * @brief This enum contains codes for all possible return values of the interface functions
@@ -306,6 +474,12 @@ INFERENCE_ENGINE_C_API(void) ie_version_free(ie_version_t *version);
  */
 INFERENCE_ENGINE_C_API(void) ie_param_free(ie_param_t *param);
 
+/**
+ * @brief Release the memory allocated by ie_param_v2_t.
+ * @param param A pointer to the ie_param_v2_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_param_v2_free(ie_param_v2_t *param);
+
 // Core
 
 /**
@@ -362,6 +536,59 @@ INFERENCE_ENGINE_C_API(void) ie_core_versions_free(ie_core_versions_t *vers);
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_read_network(ie_core_t *core, const char *xml, const char *weights_file, ie_network_t **network);
 
+/**
+ * @brief Maps a weights file read-only so that several networks can be read from it without copying it.
+ * Use the ie_weights_free() method to free memory.
+ * @ingroup Core
+ * @param weights_file .bin file's path of the IR.
+ * @param weights A pointer to the newly created weights.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_weights_create(const char *weights_file, ie_weights_t **weights);
+
+/**
+ * @brief Releases the handle of the weights. The weights stay mapped while networks read from them exist.
+ * @ingroup Core
+ * @param weights A pointer to the weights to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_weights_free(ie_weights_t **weights);
+
+/**
+ * @brief Gets the memory occupied by the shared weights.
+ * @ingroup Core
+ * @param weights A pointer to ie_weights_t instance.
+ * @param memory A pointer to the memory report.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_weights_get_memory(const ie_weights_t *weights, ie_weights_memory_t *memory);
+
+/**
+ * @brief Reads the model and weights from IR referencing shared weights. Every network read from the same weights,
+ * and every executable network loaded from them, refers to the same read-only memory wherever the reader and the
+ * plugin keep constants by reference instead of copying them. Use the ie_network_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param xml .xml file's path of the IR.
+ * @param weights A pointer to the weights created by ie_weights_create().
+ * @param network A pointer to the newly created network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_read_network_with_weights(ie_core_t *core, const char *xml, \
+        const ie_weights_t *weights, ie_network_t **network);
+
+/**
+ * @brief Reads the model from the IR content in memory. Use the ie_network_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param xml_content The content of the .xml file of the IR.
+ * @param xml_content_size Size of the content in bytes.
+ * @param weight_blob A U8 blob holding the content of the .bin file, NULL for a model without weights.
+ * @param network A pointer to the newly created network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_read_network_from_memory(ie_core_t *core, const uint8_t *xml_content, \
+        size_t xml_content_size, const ie_blob_t *weight_blob, ie_network_t **network);
+
 /**
  * @brief Creates an executable network from a network object. Users can create as many networks as they need and use
  * them simultaneously (up to the limitation of the hardware resources). Use the ie_exec_network_free() method to free memory.
@@ -376,6 +603,54 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_read_network(ie_core_t
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_load_network(ie_core_t *core, const ie_network_t *network, const char *device_name, \
         const ie_config_t *config, ie_executable_network_t **exe_network);
 
+/**
+ * @brief Reshapes the network to the maximum batch size and loads it with dynamic batching enabled, so that
+ * ie_infer_request_set_batch() can run any batch size from 1 to max_batch on its infer requests.
+ * Use the ie_exec_network_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param network A pointer to ie_network instance. Its batch size is set to max_batch.
+ * @param device_name Name of device to load network to.
+ * @param config Device configuration. DYN_BATCH_ENABLED and DYN_BATCH_LIMIT are set by the function.
+ * @param max_batch The largest batch size the infer requests will run.
+ * @param exe_network A pointer to the newly created executable network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_load_network_dyn_batch(ie_core_t *core, ie_network_t *network, \
+        const char *device_name, const ie_config_t *config, const size_t max_batch, ie_executable_network_t **exe_network);
+
+/**
+ * @brief Reads a model, applies the input and output settings and loads it in one call. The network is freed
+ * as soon as the plugin has compiled it, so the graph and the executable network are not both kept until the
+ * caller frees the network. Use the ie_exec_network_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param xml .xml file's path of the IR.
+ * @param weights_file .bin file's path of the IR, can be NULL.
+ * @param device_name Name of device to load network to.
+ * @param config Device configuration.
+ * @param preprocess_spec A pointer to the input and output settings, can be NULL.
+ * @param exe_network A pointer to the newly created executable network.
+ * @return Status code of the operation: OK(0) for success, NOT_FOUND if a port of the spec does not exist.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_load_network_from_file(ie_core_t *core, const char *xml, \
+        const char *weights_file, const char *device_name, const ie_config_t *config, const ie_preprocess_spec_t *preprocess_spec, \
+        ie_executable_network_t **exe_network);
+
+/**
+ * @brief Creates an executable network from a network previously exported with ie_exec_network_export().
+ * Use the ie_exec_network_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param file_name A path to the exported network.
+ * @param device_name Name of device to load network to.
+ * @param config Device configuration.
+ * @param exe_network A pointer to the newly created executable network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_import_network(ie_core_t *core, const char *file_name, const char *device_name, \
+        const ie_config_t *config, ie_executable_network_t **exe_network);
+
 /**
  * @brief Sets configuration for device.
  * @ingroup Core
@@ -451,6 +726,113 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_get_metric(const ie_co
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_get_config(const ie_core_t *core, const char *device_name, const char *config_name, ie_param_t *param_result);
 
+/**
+ * @brief Gets general runtime metric for dedicated hardware as a typed value. String lists such as SUPPORTED_METRICS
+ * or AVAILABLE_DEVICES are returned as arrays.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param device_name A name of a device to get a metric value.
+ * @param metric_name A metric name to request.
+ * @param param_result A metric value corresponding to the metric_name.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the value type is not supported.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_get_metric_v2(const ie_core_t *core, const char *device_name, \
+        const char *metric_name, ie_param_v2_t *param_result);
+
+/**
+ * @brief Gets configuration dedicated to device behaviour as a typed value.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param device_name A name of a device to get a configuration value.
+ * @param config_name Name of a configuration.
+ * @param param_result A configuration value corresponding to the config_name.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the value type is not supported.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_get_config_v2(const ie_core_t *core, const char *device_name, \
+        const char *config_name, ie_param_v2_t *param_result);
+
+/**
+ * @brief Builds a reusable configuration from an array of key/value pairs. The pairs are copied and converted once,
+ * so the handle can be passed to the *_with_handle functions on a hot path without per-call conversions.
+ * Use the ie_config_handle_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param device_name An optional name of a device to validate the keys against its SUPPORTED_CONFIG_KEYS metric,
+ * if NULL the keys are not validated.
+ * @param pairs An array of configuration key/value pairs.
+ * @param num Number of pairs in the array.
+ * @param handle A pointer to the newly created configuration handle.
+ * @return Status code of the operation: OK(0) for success, NOT_FOUND if a key is not supported by the device.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_config_handle_create(const ie_core_t *core, const char *device_name, \
+        const ie_config_pair_t *pairs, size_t num, ie_config_handle_t **handle);
+
+/**
+ * @brief Releases memory occupied by a configuration handle.
+ * @ingroup Core
+ * @param handle A pointer to the configuration handle to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_config_handle_free(ie_config_handle_t **handle);
+
+/**
+ * @brief Creates an executable network from a network object with a prebuilt configuration.
+ * Use the ie_exec_network_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param network A pointer to ie_network instance.
+ * @param device_name Name of device to load network to.
+ * @param handle Device configuration handle.
+ * @param exe_network A pointer to the newly created executable network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_load_network_with_handle(ie_core_t *core, const ie_network_t *network, \
+        const char *device_name, const ie_config_handle_t *handle, ie_executable_network_t **exe_network);
+
+/**
+ * @brief Sets a prebuilt configuration for device.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param handle Device configuration handle.
+ * @param device_name An optinal name of a device. If device name is not specified,
+ * the config is set for all the registered devices.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_set_config_with_handle(ie_core_t *core, const ie_config_handle_t *handle, \
+        const char *device_name);
+
+/**
+ * @brief Sweeps throughput streams, threads number and number of infer requests supported by the device, measures
+ * throughput and latency of each configuration with synthetic inputs and returns the best one for the objective.
+ * Configurations the device fails to load or run are skipped. Use the ie_config_free() method to free memory.
+ * @ingroup Core
+ * @param core A pointer to ie_core_t instance.
+ * @param network A pointer to ie_network instance.
+ * @param device_name Name of device to tune for.
+ * @param objective A pointer to the tuning objective.
+ * @param budget_ms Total time in milliseconds the sweep is allowed to take, including network loading.
+ * @param best_config A pointer to the newly created configuration to pass to ie_core_load_network().
+ * @param report An optional pointer to the measurements of the best configuration, can be NULL.
+ * @return Status code of the operation: OK(0) for success, the error of the last failed configuration if none ran.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_autotune(ie_core_t *core, const ie_network_t *network, const char *device_name, \
+        const ie_autotune_objective_t *objective, const int64_t budget_ms, ie_config_t **best_config, ie_autotune_report_t *report);
+
+/**
+ * @brief Reads a configuration stored by ie_core_autotune(). Use the ie_config_free() method to free memory.
+ * @ingroup Core
+ * @param path A path to the file with the configuration.
+ * @param config A pointer to the newly created configuration.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_config_load(const char *path, ie_config_t **config);
+
+/**
+ * @brief Releases memory occupied by a configuration created by the library.
+ * @ingroup Core
+ * @param config A pointer to the configuration to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_config_free(ie_config_t **config);
+
 /** @} */ // end of Core
 
 // ExecutableNetwork
@@ -478,6 +860,46 @@ INFERENCE_ENGINE_C_API(void) ie_exec_network_free(ie_executable_network_t **ie_e
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_create_infer_request(ie_executable_network_t *ie_exec_network, ie_infer_request_t **request);
 
+/**
+ * @brief Exports the executable network to a file which can be passed to ie_core_import_network().
+ * Not all devices support exporting.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param file_name A path to the file to export the network to.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_export(ie_executable_network_t *ie_exec_network, const char *file_name);
+
+/**
+ * @brief Gets the memory added by loading a network read with ie_core_read_network_with_weights(), that is the
+ * memory the executable network does not share with others. It is the growth of the resident set during the load.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param private_bytes A pointer to the number of bytes.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the network does not use shared weights.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_private_memory(const ie_executable_network_t *ie_exec_network, \
+        size_t *private_bytes);
+
+/**
+ * @brief Runs inferences on synthetic inputs so that lazy allocations and cold caches are paid before real traffic.
+ * Every round starts all requests at once, so every stream of the device runs at least one inference.
+ * The requests that will serve traffic should be passed, so that their own blobs are warm. Their inputs are
+ * overwritten, and a completion callback already set on them runs for every warm-up inference. Their result cache
+ * and frame gate are left untouched: warm-up outputs are neither cached nor kept as a reference frame.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param requests An array of infer requests created from ie_exec_network, or NULL to warm up temporary requests.
+ * @param num_requests Number of infer requests in the array. With no array, the number of temporary requests,
+ * 0 uses the OPTIMAL_NUMBER_OF_INFER_REQUESTS metric.
+ * @param n_iters Number of rounds, 0 means 1.
+ * @param fill_mode Data written to the inputs.
+ * @param report An optional pointer to the measured latencies, can be NULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_warmup(ie_executable_network_t *ie_exec_network, \
+        ie_infer_request_t **requests, size_t num_requests, size_t n_iters, warmup_fill_e fill_mode, ie_warmup_report_t *report);
+
 /**
  * @brief Gets general runtime metric for an executable network. It can be network name, actual device ID on which executable network is running
  * or all other properties which cannot be changed dynamically.
@@ -500,6 +922,16 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_metric(con
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_set_config(ie_executable_network_t *ie_exec_network, const ie_config_t *param_config);
 
+/**
+ * @brief Sets a prebuilt configuration for current executable network.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param handle Configuration handle.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_set_config_with_handle(ie_executable_network_t *ie_exec_network, \
+        const ie_config_handle_t *handle);
+
 /**
  * @brief Gets configuration for current executable network. The method is responsible to
  * extract information which affects executable network execution.
@@ -512,6 +944,28 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_set_config(ie_
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_config(const ie_executable_network_t *ie_exec_network, \
         const char *metric_config, ie_param_t *param_result);
 
+/**
+ * @brief Gets general runtime metric for an executable network as a typed value.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param metric_name A metric name to request.
+ * @param param_result A metric value corresponding to the metric_name.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the value type is not supported.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_metric_v2(const ie_executable_network_t *ie_exec_network, \
+        const char *metric_name, ie_param_v2_t *param_result);
+
+/**
+ * @brief Gets configuration for current executable network as a typed value.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param metric_config A configuration parameter name to request.
+ * @param param_result A configuration value corresponding to a configuration paramter name.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the value type is not supported.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_config_v2(const ie_executable_network_t *ie_exec_network, \
+        const char *metric_config, ie_param_v2_t *param_result);
+
 /** @} */ // end of ExecutableNetwork
 
 // InferRequest
@@ -592,10 +1046,29 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  * @ingroup InferRequest
  * @param infer_request A pointer to ie_infer_request_t instance.
  * @param size New batch size to be used by all the following inference calls for this request.
- * @return Status code of the operation: OK(0) for success.
+ * @return Status code of the operation: OK(0) for success, OUT_OF_BOUNDS if size is 0 or above the max_batch
+ * given to ie_core_load_network_dyn_batch().
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Gets per-layer performance counters of the last inference. The executable network must be loaded
+ * with the config PERF_COUNT set to YES. Use the ie_profiling_infos_free() method to free memory.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param perf_counts A pointer to the counters of all layers, ordered by execution index.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_performance_counts(ie_infer_request_t *infer_request, \
+        ie_profiling_infos_t *perf_counts);
+
+/**
+ * @brief Releases memory occupied by ie_profiling_infos_t.
+ * @ingroup InferRequest
+ * @param perf_counts A pointer to the ie_profiling_infos_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_profiling_infos_free(ie_profiling_infos_t *perf_counts);
+
 /** @} */ // end of InferRequest
 
 // Network
@@ -975,6 +1448,1282 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_get_precision(const ie
  */
 INFERENCE_ENGINE_C_API(void) ie_blob_free(ie_blob_t **blob);
 
+/**
+ * @struct ie_quantization
+ * @brief Represents the quantization of a U8 or I8 blob: real value = scale * (quantized value - zero_point).
+ */
+typedef struct ie_quantization {
+    float scale;
+    int32_t zero_point;
+}ie_quantization_t;
+
+/**
+ * @brief Converts the elements of a blob to another blob of the same dimensions, changing the precision and the layout
+ * in one pass. Precisions are FP32, FP16, U8 and I8; layouts are the same on both sides, or NCHW and NHWC. FP16 is
+ * converted with F16C and U8 and I8 with AVX2 where the CPU has them, rounding to nearest even. Large tensors are
+ * converted on several threads. ROI and compound blobs are not supported.
+ * @ingroup Blob
+ * @param src_blob A pointer to the blob to read.
+ * @param dst_blob A pointer to the blob to write.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED for an unsupported precision or layout.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_convert(const ie_blob_t *src_blob, ie_blob_t *dst_blob);
+
+/**
+ * @brief Converts like ie_blob_convert(), dequantizing a U8 or I8 source and quantizing a U8 or I8 destination.
+ * Quantized values are rounded to nearest even and saturated.
+ * @ingroup Blob
+ * @param src_blob A pointer to the blob to read.
+ * @param src_quantization A pointer to the quantization of the source, NULL for a scale of 1 and a zero point of 0.
+ * @param dst_blob A pointer to the blob to write.
+ * @param dst_quantization A pointer to the quantization of the destination, NULL for a scale of 1 and a zero point of 0.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_convert_quantized(const ie_blob_t *src_blob, \
+        const ie_quantization_t *src_quantization, ie_blob_t *dst_blob, const ie_quantization_t *dst_quantization);
+
 /** @} */ // end of Blob
 
+// Scheduler
+
+/**
+ * @defgroup Scheduler Scheduler
+ * Set of functions to share one executable network between several classes of
+ * traffic. Jobs are queued in front of a pool of infer requests, higher priority
+ * classes are always served first and flows inside one class share the pool
+ * proportionally to their weights.
+ * @{
+ */
+
+typedef struct ie_scheduler ie_scheduler_t;
+
+/**
+ * @struct ie_scheduler_config
+ * @brief Represents configuration of the scheduler.
+ */
+typedef struct ie_scheduler_config {
+    size_t num_requests;     // number of infer requests in the pool, 0 means 1
+    size_t num_classes;      // number of strict-priority classes, class 0 is the highest priority
+    size_t max_queue_depth;  // maximum number of queued jobs per class, 0 means unlimited
+}ie_scheduler_config_t;
+
+/**
+ * @struct ie_scheduler_job
+ * @brief Represents a job submitted to the scheduler.
+ * prepare is called once a request of the pool is assigned to the job and should set the input blobs,
+ * complete is called when the inference is done or failed and is the place to read the output blobs.
+ * The request is returned to the pool after complete returns.
+ */
+typedef struct ie_scheduler_job {
+    IEStatusCode (*prepare)(ie_infer_request_t *request, void *args);
+    void (*complete)(ie_infer_request_t *request, IEStatusCode status, void *args);
+    void *args;
+}ie_scheduler_job_t;
+
+/**
+ * @struct ie_scheduler_class_stats
+ * @brief Represents queueing statistics of one priority class.
+ */
+typedef struct ie_scheduler_class_stats {
+    size_t queue_depth;   // number of jobs waiting for a request
+    size_t in_flight;     // number of jobs being inferred
+    size_t submitted;     // total number of accepted jobs
+    size_t rejected;      // total number of jobs rejected because the queue was full
+    size_t completed;     // total number of completed jobs
+    double avg_wait_ms;   // average time between submission and start of inference
+    double max_wait_ms;   // maximum time between submission and start of inference
+}ie_scheduler_class_stats_t;
+
+/**
+ * @brief Creates a scheduler and the pool of infer requests for the executable network.
+ * The executable network must outlive the scheduler. Use the ie_scheduler_free() method to free memory.
+ * @ingroup Scheduler
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param config A pointer to the scheduler configuration.
+ * @param scheduler A pointer to the newly created scheduler.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_scheduler_create(ie_executable_network_t *ie_exec_network, \
+        const ie_scheduler_config_t *config, ie_scheduler_t **scheduler);
+
+/**
+ * @brief Waits for the jobs in flight, completes the queued jobs with INFER_NOT_STARTED status and releases
+ * memory occupied by the scheduler.
+ * @ingroup Scheduler
+ * @param scheduler A pointer to the scheduler to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_scheduler_free(ie_scheduler_t **scheduler);
+
+/**
+ * @brief Sets the weight of a flow inside a priority class. Flows which were never configured have weight 1.
+ * @ingroup Scheduler
+ * @param scheduler A pointer to ie_scheduler_t instance.
+ * @param class_id Priority class of the flow.
+ * @param flow_id Identifier of the flow chosen by the caller.
+ * @param weight Share of the flow relative to the other flows of the class, must be positive.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_scheduler_set_flow_weight(ie_scheduler_t *scheduler, size_t class_id, \
+        uint32_t flow_id, double weight);
+
+/**
+ * @brief Queues a job. The job is started as soon as a request is free and no job of a higher priority
+ * class is waiting.
+ * @ingroup Scheduler
+ * @param scheduler A pointer to ie_scheduler_t instance.
+ * @param class_id Priority class of the job.
+ * @param flow_id Flow of the job inside the class.
+ * @param job A pointer to the job description, it is copied.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY if the queue of the class is full.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_scheduler_submit(ie_scheduler_t *scheduler, size_t class_id, \
+        uint32_t flow_id, const ie_scheduler_job_t *job);
+
+/**
+ * @brief Gets queueing statistics of a priority class.
+ * @ingroup Scheduler
+ * @param scheduler A pointer to ie_scheduler_t instance.
+ * @param class_id Priority class to get statistics for.
+ * @param stats A pointer to the statistics of the class.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_scheduler_get_class_stats(ie_scheduler_t *scheduler, size_t class_id, \
+        ie_scheduler_class_stats_t *stats);
+
+/** @} */ // end of Scheduler
+
+// NumaNetwork
+
+/**
+ * @defgroup NumaNetwork NumaNetwork
+ * Set of functions to replicate an executable network on every NUMA node of the host.
+ * Every replica is loaded, and runs its first inferences, on a thread bound to the CPUs and the memory
+ * of its node and owns a node-local pool of infer requests. Requests are handed out from the replica
+ * of the caller's node and from a remote replica only when all local requests are busy.
+ * Binding the computation is best effort: plugin threads started for the replica inherit the binding,
+ * but threads of a pool shared by the process, such as TBB or OpenMP workers started earlier, do not.
+ * ie_numa_network_is_replica_bound() tells whether the binding of a replica was verified.
+ * @{
+ */
+
+typedef struct ie_numa_network ie_numa_network_t;
+
+/**
+ * @brief Loads one executable network per NUMA node and creates a pool of infer requests for each of them.
+ * On hosts with a single node or on platforms without NUMA support one replica is created.
+ * Use the ie_numa_network_free() method to free memory.
+ * @ingroup NumaNetwork
+ * @param core A pointer to ie_core_t instance.
+ * @param network A pointer to ie_network instance.
+ * @param device_name Name of device to load network to.
+ * @param config Device configuration. For CPU, CPU_THREADS_NUM and CPU_BIND_THREAD default to the node size
+ * and to NO so that the plugin threads stay on the node the replica is loaded on.
+ * @param requests_per_node Number of infer requests created for every replica, 0 means 1.
+ * @param numa_network A pointer to the newly created replicated network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_core_load_network_numa(ie_core_t *core, const ie_network_t *network, \
+        const char *device_name, const ie_config_t *config, size_t requests_per_node, ie_numa_network_t **numa_network);
+
+/**
+ * @brief Releases memory occupied by the replicas and their infer requests. All acquired requests must be released before.
+ * @ingroup NumaNetwork
+ * @param numa_network A pointer to the replicated network to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_numa_network_free(ie_numa_network_t **numa_network);
+
+/**
+ * @brief Gets number of replicas, which is the number of NUMA nodes used.
+ * @ingroup NumaNetwork
+ * @param numa_network A pointer to ie_numa_network_t instance.
+ * @param size_result Number of replicas.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_numa_network_get_replicas_number(const ie_numa_network_t *numa_network, size_t *size_result);
+
+/**
+ * @brief Gets the executable network of a replica, e.g. to query its metrics. The network is owned by numa_network.
+ * @ingroup NumaNetwork
+ * @param numa_network A pointer to ie_numa_network_t instance.
+ * @param replica Index of the replica.
+ * @param ie_exec_network A pointer to the executable network of the replica.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_numa_network_get_replica(ie_numa_network_t *numa_network, size_t replica, \
+        ie_executable_network_t **ie_exec_network);
+
+/**
+ * @brief Gets whether the computation of a replica is known to be bound to its node: threads were started while the
+ * replica was loaded and ran its first inferences, and all of them may only run on the CPUs of the node.
+ * @ingroup NumaNetwork
+ * @param numa_network A pointer to ie_numa_network_t instance.
+ * @param replica Index of the replica.
+ * @param bound A pointer to 1 if the binding was verified, 0 if the replica may run on threads outside its node.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_numa_network_is_replica_bound(const ie_numa_network_t *numa_network, \
+        size_t replica, int *bound);
+
+/**
+ * @brief Takes an idle infer request, preferring the replica on the NUMA node of the calling thread.
+ * @ingroup NumaNetwork
+ * @param numa_network A pointer to ie_numa_network_t instance.
+ * @param timeout Maximum duration in milliseconds to block for while all requests are busy, 0 returns immediately
+ * and -1 waits until a request is released.
+ * @param request A pointer to the acquired infer request, owned by numa_network.
+ * @param replica An optional pointer to the index of the replica the request belongs to, can be NULL.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY if no request became idle in time.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_numa_network_acquire_request(ie_numa_network_t *numa_network, const int64_t timeout, \
+        ie_infer_request_t **request, size_t *replica);
+
+/**
+ * @brief Returns an infer request taken by ie_numa_network_acquire_request() to its pool.
+ * @ingroup NumaNetwork
+ * @param numa_network A pointer to ie_numa_network_t instance.
+ * @param request A pointer to the infer request to release.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_numa_network_release_request(ie_numa_network_t *numa_network, ie_infer_request_t *request);
+
+/** @} */ // end of NumaNetwork
+
+// ModelRegistry
+
+/**
+ * @defgroup ModelRegistry ModelRegistry
+ * Set of functions to serve many models from one core within a memory budget.
+ * Models are registered by id, read and loaded on their first use and the least recently
+ * used idle executable networks are evicted when the budget is exceeded. When a cache
+ * directory is given, loaded networks are exported to it so that reloads import them.
+ * @{
+ */
+
+typedef struct ie_model_registry ie_model_registry_t;
+
+/**
+ * @struct ie_model_registry_config
+ * @brief Represents configuration of the model registry.
+ */
+typedef struct ie_model_registry_config {
+    const char *device_name;      // device to load the models to
+    const ie_config_t *config;    // device configuration used for every model, copied, can be NULL
+    size_t memory_budget;         // bytes the loaded networks may use, 0 means unlimited
+    const char *cache_dir;        // optional directory for exported networks, can be NULL
+}ie_model_registry_config_t;
+
+/**
+ * @struct ie_model_stats
+ * @brief Represents usage statistics of one model of the registry.
+ */
+typedef struct ie_model_stats {
+    size_t requests;      // number of ie_model_registry_acquire() calls
+    size_t hits;          // acquisitions served by a resident network
+    size_t loads;         // loads from the IR
+    size_t imports;       // loads from the exported network cache
+    size_t evictions;     // number of times the network was evicted
+    double hit_rate;      // hits / requests
+    double last_load_ms;  // duration of the last load or import
+    double avg_load_ms;   // average duration of loads and imports
+    size_t memory_bytes;  // memory accounted to the network: the resident set growth of its last load, at least its weights
+    int resident;         // 1 if the network is loaded
+}ie_model_stats_t;
+
+/**
+ * @brief Creates an empty model registry. The core must outlive the registry.
+ * Use the ie_model_registry_free() method to free memory.
+ * @ingroup ModelRegistry
+ * @param core A pointer to ie_core_t instance.
+ * @param config A pointer to the registry configuration.
+ * @param registry A pointer to the newly created registry.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_model_registry_create(ie_core_t *core, const ie_model_registry_config_t *config, \
+        ie_model_registry_t **registry);
+
+/**
+ * @brief Releases memory occupied by the registry and all its executable networks.
+ * @ingroup ModelRegistry
+ * @param registry A pointer to the registry to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_model_registry_free(ie_model_registry_t **registry);
+
+/**
+ * @brief Registers a model. The model is not read until it is acquired.
+ * @ingroup ModelRegistry
+ * @param registry A pointer to ie_model_registry_t instance.
+ * @param model_id Identifier of the model.
+ * @param xml .xml file's path of the IR.
+ * @param weights_file .bin file's path of the IR, can be NULL to use the .bin file next to the .xml one.
+ * @return Status code of the operation: OK(0) for success, PARAMETER_MISMATCH if the id is already registered.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_model_registry_add_model(ie_model_registry_t *registry, const char *model_id, \
+        const char *xml, const char *weights_file);
+
+/**
+ * @brief Gets the executable network of a model, loading it if it is not resident. The network is owned by
+ * the registry and is not evicted until it is released; infer requests created from it must be freed before.
+ * @ingroup ModelRegistry
+ * @param registry A pointer to ie_model_registry_t instance.
+ * @param model_id Identifier of the model.
+ * @param exe_network A pointer to the executable network of the model.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_model_registry_acquire(ie_model_registry_t *registry, const char *model_id, \
+        ie_executable_network_t **exe_network);
+
+/**
+ * @brief Releases an executable network taken by ie_model_registry_acquire(), making it a candidate for eviction.
+ * @ingroup ModelRegistry
+ * @param registry A pointer to ie_model_registry_t instance.
+ * @param model_id Identifier of the model.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_model_registry_release(ie_model_registry_t *registry, const char *model_id);
+
+/**
+ * @brief Gets usage statistics of a model.
+ * @ingroup ModelRegistry
+ * @param registry A pointer to ie_model_registry_t instance.
+ * @param model_id Identifier of the model.
+ * @param stats A pointer to the statistics of the model.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_model_registry_get_model_stats(ie_model_registry_t *registry, const char *model_id, \
+        ie_model_stats_t *stats);
+
+/**
+ * @brief Gets the memory accounted to the resident networks.
+ * @ingroup ModelRegistry
+ * @param registry A pointer to ie_model_registry_t instance.
+ * @param used_bytes A pointer to the number of bytes used.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_model_registry_get_memory_usage(ie_model_registry_t *registry, size_t *used_bytes);
+
+/** @} */ // end of ModelRegistry
+
+// VersionedNetwork
+
+/**
+ * @defgroup VersionedNetwork VersionedNetwork
+ * Set of functions to replace the model behind a pool of infer requests without stopping it.
+ * A new version is read and loaded in the background and then published at once: requests acquired
+ * afterwards come from the new version, while the previous version is freed when its last request is released.
+ * @{
+ */
+
+typedef struct ie_versioned_network ie_versioned_network_t;
+
+/**
+ * @brief Reads and loads the first version of a model and creates its pool of infer requests.
+ * Use the ie_versioned_network_free() method to free memory.
+ * @ingroup VersionedNetwork
+ * @param core A pointer to ie_core_t instance. The core must outlive the versioned network.
+ * @param xml .xml file's path of the IR.
+ * @param weights_file .bin file's path of the IR, can be NULL.
+ * @param device_name Name of device to load network to.
+ * @param config Device configuration, copied and reused for every version.
+ * @param num_requests Number of infer requests of every version, 0 means 1.
+ * @param versioned_network A pointer to the newly created versioned network.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_versioned_network_create(ie_core_t *core, const char *xml, const char *weights_file, \
+        const char *device_name, const ie_config_t *config, size_t num_requests, ie_versioned_network_t **versioned_network);
+
+/**
+ * @brief Waits for a pending update and releases memory occupied by all versions.
+ * All acquired requests must be released before.
+ * @ingroup VersionedNetwork
+ * @param versioned_network A pointer to the versioned network to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_versioned_network_free(ie_versioned_network_t **versioned_network);
+
+/**
+ * @brief Starts loading a new version of the model in the background. The function returns immediately,
+ * use ie_versioned_network_wait_update() to get the result.
+ * @ingroup VersionedNetwork
+ * @param versioned_network A pointer to ie_versioned_network_t instance.
+ * @param xml .xml file's path of the IR.
+ * @param weights_file .bin file's path of the IR, can be NULL.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY if another update is in progress.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_versioned_network_update(ie_versioned_network_t *versioned_network, \
+        const char *xml, const char *weights_file);
+
+/**
+ * @brief Waits for the update started by ie_versioned_network_update() to be published.
+ * @ingroup VersionedNetwork
+ * @param versioned_network A pointer to ie_versioned_network_t instance.
+ * @param timeout Maximum duration in milliseconds to block for, a negative value blocks until the update ends.
+ * @return Status code of the update: OK(0) if the new version is published, RESULT_NOT_READY on timeout.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_versioned_network_wait_update(ie_versioned_network_t *versioned_network, \
+        const int64_t timeout);
+
+/**
+ * @brief Gets the number of the published version, starting from 1.
+ * @ingroup VersionedNetwork
+ * @param versioned_network A pointer to ie_versioned_network_t instance.
+ * @param version A pointer to the version number.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_versioned_network_get_version(ie_versioned_network_t *versioned_network, size_t *version);
+
+/**
+ * @brief Takes an idle infer request of the published version.
+ * @ingroup VersionedNetwork
+ * @param versioned_network A pointer to ie_versioned_network_t instance.
+ * @param timeout Maximum duration in milliseconds to block for while all requests are busy, 0 returns immediately
+ * and a negative value blocks until a request is released.
+ * @param request A pointer to the acquired infer request, owned by versioned_network.
+ * @param version An optional pointer to the version the request belongs to, can be NULL.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY on timeout.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_versioned_network_acquire_request(ie_versioned_network_t *versioned_network, \
+        const int64_t timeout, ie_infer_request_t **request, size_t *version);
+
+/**
+ * @brief Returns an infer request taken by ie_versioned_network_acquire_request(). Releasing the last request of
+ * a replaced version frees that version, so this function must not be called from the request's completion callback.
+ * @ingroup VersionedNetwork
+ * @param versioned_network A pointer to ie_versioned_network_t instance.
+ * @param request A pointer to the infer request to release.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_versioned_network_release_request(ie_versioned_network_t *versioned_network, \
+        ie_infer_request_t *request);
+
+/** @} */ // end of VersionedNetwork
+
+// BucketedNetwork
+
+/**
+ * @defgroup BucketedNetwork BucketedNetwork
+ * Set of functions to serve inputs of varying shape from a small set of networks compiled for fixed shapes.
+ * Every request goes to the smallest compiled shape (bucket) its inputs fit in and the inputs are zero padded
+ * to that shape. Shapes that fit no bucket, or fill their bucket poorly, are compiled in the background.
+ * @{
+ */
+
+typedef struct ie_bucket_set ie_bucket_set_t;
+
+/**
+ * @struct ie_bucket_set_config
+ * @brief Represents configuration of a bucketed network.
+ */
+typedef struct ie_bucket_set_config {
+    const char *device_name;          // device to load the buckets to
+    const ie_config_t *config;        // device configuration, copied, can be NULL
+    const input_shapes_t *buckets;    // shapes compiled at creation, NULL compiles the shape of the IR
+    size_t num_buckets;               // number of elements in buckets
+    size_t max_buckets;               // limit of buckets learned from traffic included, 0 disables learning
+    size_t round_to;                  // learned dimensions are rounded up to a multiple of it, 0 means 1
+    double min_fill;                  // a tighter bucket is learned when the input fills less of its bucket, in [0, 1]
+    size_t requests_per_bucket;       // number of infer requests of every bucket, 0 means 1
+}ie_bucket_set_config_t;
+
+/**
+ * @struct ie_named_blob
+ * @brief Represents an input blob with the name of its network input.
+ */
+typedef struct ie_named_blob {
+    const char *name;
+    ie_blob_t *blob;
+}ie_named_blob_t;
+
+/**
+ * @brief Reads a model and compiles the initial buckets. Use the ie_bucket_set_free() method to free memory.
+ * @ingroup BucketedNetwork
+ * @param core A pointer to ie_core_t instance. The core must outlive the bucket set.
+ * @param xml .xml file's path of the IR.
+ * @param weights_file .bin file's path of the IR, can be NULL.
+ * @param config A pointer to the configuration of the bucket set.
+ * @param bucket_set A pointer to the newly created bucket set.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_bucket_set_create(ie_core_t *core, const char *xml, const char *weights_file, \
+        const ie_bucket_set_config_t *config, ie_bucket_set_t **bucket_set);
+
+/**
+ * @brief Waits for background compilations and releases memory occupied by all buckets.
+ * All acquired requests must be released before.
+ * @ingroup BucketedNetwork
+ * @param bucket_set A pointer to the bucket set to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_bucket_set_free(ie_bucket_set_t **bucket_set);
+
+/**
+ * @brief Takes an idle infer request of the smallest bucket the inputs fit in and copies the inputs into it,
+ * zero padding every dimension up to the bucket shape. The outputs of the request have the shape of the bucket.
+ * Blobs must have the precision, layout and rank of the network inputs.
+ * @ingroup BucketedNetwork
+ * @param bucket_set A pointer to ie_bucket_set_t instance.
+ * @param inputs Input blobs of the request.
+ * @param num_inputs Number of elements in inputs.
+ * @param timeout Maximum duration in milliseconds to block for while all requests of the bucket are busy,
+ * 0 returns immediately and a negative value blocks until a request is released.
+ * @param request A pointer to the acquired infer request, owned by bucket_set.
+ * @param bucket An optional pointer to the index of the bucket used, can be NULL.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY on timeout,
+ * OUT_OF_BOUNDS if the inputs fit no bucket and learning is disabled.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_bucket_set_acquire_request(ie_bucket_set_t *bucket_set, const ie_named_blob_t *inputs, \
+        size_t num_inputs, const int64_t timeout, ie_infer_request_t **request, size_t *bucket);
+
+/**
+ * @brief Returns an infer request taken by ie_bucket_set_acquire_request() to its bucket.
+ * @ingroup BucketedNetwork
+ * @param bucket_set A pointer to ie_bucket_set_t instance.
+ * @param request A pointer to the infer request to release.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_bucket_set_release_request(ie_bucket_set_t *bucket_set, ie_infer_request_t *request);
+
+/**
+ * @brief Gets number of compiled buckets.
+ * @ingroup BucketedNetwork
+ * @param bucket_set A pointer to ie_bucket_set_t instance.
+ * @param size_result Number of buckets.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_bucket_set_get_buckets_number(ie_bucket_set_t *bucket_set, size_t *size_result);
+
+/**
+ * @brief Gets the input shapes of a bucket. Use the ie_network_input_shapes_free() method to free memory.
+ * @ingroup BucketedNetwork
+ * @param bucket_set A pointer to ie_bucket_set_t instance.
+ * @param bucket Index of the bucket.
+ * @param shapes A pointer to the input shapes of the bucket.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_bucket_set_get_bucket_shapes(ie_bucket_set_t *bucket_set, size_t bucket, \
+        input_shapes_t *shapes);
+
+/** @} */ // end of BucketedNetwork
+
+// MemoryStats
+
+/**
+ * @defgroup MemoryStats MemoryStats
+ * Set of functions to account the memory used through the C API.
+ * Counters are process-wide and cover every object created by the wrapper until it is freed.
+ * @{
+ */
+
+/**
+ * @struct ie_memory_stats
+ * @brief Represents the memory of the live objects created through the C API.
+ */
+typedef struct ie_memory_stats {
+    size_t num_cores;                // live ie_core_t
+    size_t num_networks;             // live ie_network_t
+    size_t num_executable_networks;  // live ie_executable_network_t
+    size_t num_infer_requests;       // live ie_infer_request_t
+    size_t num_blobs;                // live ie_blob_t
+    size_t wrapper_bytes;            // bytes of the wrapper objects themselves
+    size_t blob_bytes;               // data allocated by ie_blob_make_memory() for live blobs
+    size_t request_blob_bytes;       // data of the input and output blobs of live infer requests
+    size_t network_bytes;            // resident set growth measured while loading live executable networks
+}ie_memory_stats_t;
+
+/**
+ * @struct ie_memory_site_stats
+ * @brief Represents the memory allocated by one entry point of the C API.
+ */
+typedef struct ie_memory_site_stats {
+    const char *site;     // name of the entry point, a static string
+    size_t allocations;   // objects created
+    size_t frees;         // objects freed
+    size_t live_bytes;    // wrapper and data bytes of the live objects
+}ie_memory_site_stats_t;
+
+/**
+ * @struct ie_exec_memory_stats
+ * @brief Represents the memory of one executable network and its infer requests.
+ */
+typedef struct ie_exec_memory_stats {
+    size_t network_bytes;        // resident set growth measured while loading the network
+    size_t num_infer_requests;   // live infer requests created from the network
+    size_t request_blob_bytes;   // data of the input and output blobs of those requests
+}ie_exec_memory_stats_t;
+
+/**
+ * @brief Gets the memory statistics of the C API, optionally with the breakdown per allocation site.
+ * Network memory is measured as the growth of the resident set while loading and includes
+ * whatever other threads allocated at the same time.
+ * @ingroup MemoryStats
+ * @param stats A pointer to the statistics.
+ * @param sites An optional array receiving the statistics per allocation site, can be NULL.
+ * @param num_sites Capacity of sites on input, number of allocation sites on output. Can be NULL if sites is NULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_get_memory_stats(ie_memory_stats_t *stats, ie_memory_site_stats_t *sites, \
+        size_t *num_sites);
+
+/**
+ * @brief Gets the memory statistics of an executable network.
+ * @ingroup MemoryStats
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param stats A pointer to the statistics.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_memory_stats(const ie_executable_network_t *ie_exec_network, \
+        ie_exec_memory_stats_t *stats);
+
+/**
+ * @brief Gets the bytes taken by one input or output across the live infer requests of an executable network.
+ * @ingroup MemoryStats
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param port_name Name of the input or output.
+ * @param bytes A pointer to the number of bytes.
+ * @return Status code of the operation: OK(0) for success, NOT_FOUND if no request has the port.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_port_memory(const ie_executable_network_t *ie_exec_network, \
+        const char *port_name, size_t *bytes);
+
+/** @} */ // end of MemoryStats
+
+// Trace
+
+/**
+ * @defgroup Trace Trace
+ * Set of functions to record a timeline of the C API calls in the Chrome trace event format, which can be
+ * opened in chrome://tracing or Perfetto. Spans cover reading and loading networks, ie_infer_request_set_blob(),
+ * ie_infer_request_infer(), ie_infer_request_infer_async(), ie_infer_request_wait() and completion callbacks,
+ * with the thread id and an id of the infer request. Every thread records into its own buffer without locking.
+ * @{
+ */
+
+/**
+ * @brief Starts recording. Events of previous recordings are discarded.
+ * @ingroup Trace
+ * @param events_per_thread Capacity of the buffer of every thread, 0 means 65536.
+ * Events past the capacity are dropped and counted.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY if a recording is in progress.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_trace_start(size_t events_per_thread);
+
+/**
+ * @brief Stops recording and writes the events as Chrome trace JSON.
+ * @ingroup Trace
+ * @param path Path of the JSON file, NULL discards the events.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_trace_stop(const char *path);
+
+/** @} */ // end of Trace
+
+// Capture
+
+/**
+ * @defgroup Capture Capture
+ * Set of functions to record the traffic of infer requests and to replay it. A capture attached to infer requests
+ * appends every sampled ie_infer_request_infer() and ie_infer_request_infer_async() call to a binary log: the submit
+ * time and the content of the inputs given to ie_infer_request_set_blob(). The log is a ie_capture_file_header_t
+ * followed by records. Every record is a ie_capture_record_t followed by num_inputs times a ie_capture_input_t, the
+ * NUL-terminated name and the data. Names and data are padded to 8 bytes, so a mapped log can be used in place.
+ * @{
+ */
+
+typedef struct ie_capture ie_capture_t;
+
+#define IE_CAPTURE_MAGIC "IECAPTUR"
+#define IE_CAPTURE_VERSION 1
+
+/**
+ * @struct ie_capture_file_header
+ * @brief Represents the header at the beginning of a capture log.
+ */
+typedef struct ie_capture_file_header {
+    char magic[8];          // IE_CAPTURE_MAGIC without the terminator
+    uint32_t version;       // IE_CAPTURE_VERSION
+    uint32_t header_size;   // sizeof(ie_capture_file_header_t)
+    uint64_t created_ns;    // wall clock time of ie_capture_create() in nanoseconds since the epoch
+}ie_capture_file_header_t;
+
+/**
+ * @struct ie_capture_record
+ * @brief Represents one submitted inference in a capture log.
+ */
+typedef struct ie_capture_record {
+    uint64_t size;          // bytes of the record with its inputs
+    uint64_t timestamp_ns;  // submit time in nanoseconds since ie_capture_create()
+    uint64_t request_id;    // identifies the infer request within the process
+    uint32_t num_inputs;
+    uint32_t async;         // 1 for ie_infer_request_infer_async(), 0 for ie_infer_request_infer()
+}ie_capture_record_t;
+
+/**
+ * @struct ie_capture_input
+ * @brief Represents one input of a record in a capture log.
+ */
+typedef struct ie_capture_input {
+    uint64_t data_size;     // bytes of the data
+    uint32_t name_size;     // bytes of the name with its terminator and padding
+    int32_t precision;      // precision_e
+    int32_t layout;         // layout_e
+    uint32_t ranks;
+    uint64_t dims[8];
+}ie_capture_input_t;
+
+/**
+ * @struct ie_capture_config
+ * @brief Represents configuration of a capture.
+ */
+typedef struct ie_capture_config {
+    const char *path;       // log file, truncated on creation
+    double sample_rate;     // fraction of the submits recorded, evenly spaced, in (0, 1]
+    uint64_t max_bytes;     // records which would grow the log beyond are dropped, 0 means unlimited
+}ie_capture_config_t;
+
+/**
+ * @struct ie_capture_stats
+ * @brief Represents counters of a capture.
+ */
+typedef struct ie_capture_stats {
+    uint64_t submits;       // submits of the attached infer requests
+    uint64_t recorded;      // records written
+    uint64_t dropped;       // sampled records dropped by the size limit, or since a write to the log failed
+    uint64_t bytes;         // size of the log
+}ie_capture_stats_t;
+
+/**
+ * @struct ie_replay_config
+ * @brief Represents configuration of a replay.
+ */
+typedef struct ie_replay_config {
+    double speed;           // 1 keeps the recorded arrival times, 2 replays twice as fast, 0 submits without waiting
+    size_t num_requests;    // infer requests used for the replay, 0 means 4
+}ie_replay_config_t;
+
+/**
+ * @struct ie_replay_report
+ * @brief Represents results of a replay.
+ */
+typedef struct ie_replay_report {
+    size_t num_inferences;  // records replayed
+    size_t num_failed;      // inferences which failed
+    double duration_ms;     // duration of the whole replay
+    double latency_avg_ms;  // latencies from the submit to the completion callback
+    double latency_p50_ms;
+    double latency_p90_ms;
+    double latency_p99_ms;
+    double latency_max_ms;
+    double max_lag_ms;      // largest delay of a submit behind the schedule because no infer request was idle
+}ie_replay_report_t;
+
+/**
+ * @brief Creates a capture writing to a new log. Use the ie_capture_free() method to free memory.
+ * @ingroup Capture
+ * @param config A pointer to the capture configuration.
+ * @param capture A pointer to the newly created capture.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_capture_create(const ie_capture_config_t *config, ie_capture_t **capture);
+
+/**
+ * @brief Releases the capture. The log is closed once no infer request is attached to it any more.
+ * @ingroup Capture
+ * @param capture A pointer to the capture to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_capture_free(ie_capture_t **capture);
+
+/**
+ * @brief Gets counters of the capture and flushes the log. Once a write fails, the log ends with a partial
+ * record, later records are dropped and the call returns GENERAL_ERROR.
+ * @ingroup Capture
+ * @param capture A pointer to ie_capture_t instance.
+ * @param stats A pointer to the counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_capture_get_stats(ie_capture_t *capture, ie_capture_stats_t *stats);
+
+/**
+ * @brief Attaches the infer request to a capture. Inputs are recorded when set with ie_infer_request_set_blob()
+ * after the request was attached.
+ * @ingroup Capture
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param capture A pointer to ie_capture_t instance, NULL detaches the request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_capture(ie_infer_request_t *infer_request, ie_capture_t *capture);
+
+/**
+ * @brief Replays a capture log through infer requests of the executable network and measures the latencies.
+ * Input data is used in place from the mapped log.
+ * @ingroup Capture
+ * @param exe_network A pointer to ie_executable_network_t instance loaded from the captured model.
+ * @param path Path of the capture log.
+ * @param config A pointer to the replay configuration, NULL replays at the recorded speed with 4 infer requests.
+ * @param report A pointer to the results.
+ * @return Status code of the operation: OK(0) for success, NOT_FOUND if the log cannot be opened, GENERAL_ERROR if it is
+ * not a capture log.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_replay_run(ie_executable_network_t *exe_network, const char *path, \
+        const ie_replay_config_t *config, ie_replay_report_t *report);
+
+/** @} */ // end of Capture
+
+// ResultCache
+
+/**
+ * @defgroup ResultCache ResultCache
+ * Set of functions to skip inferences on inputs which were inferred before. With a cache attached, an infer request
+ * hashes the content of all its inputs on ie_infer_request_infer() and ie_infer_request_infer_async(). On a hit the
+ * cached outputs are copied to the output blobs of the request and no inference runs, ie_infer_request_wait() returns
+ * OK at once and the completion callback runs on a thread of the cache. On a miss the outputs are inserted when the
+ * inference succeeds. Inputs are told apart by a 128-bit hash, computed with SSE2 or AVX2 where available.
+ * @{
+ */
+
+typedef struct ie_result_cache ie_result_cache_t;
+
+/**
+ * @struct ie_result_cache_config
+ * @brief Represents configuration of a result cache.
+ */
+typedef struct ie_result_cache_config {
+    size_t capacity;        // maximum number of entries, the least recently used are evicted
+    int64_t ttl_ms;         // entries older than this are not used any more, 0 means they never expire
+}ie_result_cache_config_t;
+
+/**
+ * @struct ie_result_cache_stats
+ * @brief Represents counters of a result cache.
+ */
+typedef struct ie_result_cache_stats {
+    uint64_t lookups;       // submits of the attached infer requests which hashed their inputs
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t evictions;     // entries evicted by the capacity
+    uint64_t expirations;   // entries found older than the TTL
+    uint64_t bypassed;      // submits with an input that has no plain buffer, such as NV12 or ROI blobs
+    size_t entries;
+    size_t bytes;           // size of the cached outputs
+    double hit_rate;        // hits / lookups
+    double hash_ms;         // total time spent hashing inputs
+}ie_result_cache_stats_t;
+
+/**
+ * @brief Creates an empty result cache for infer requests of the executable network.
+ * Use the ie_result_cache_free() method to free memory.
+ * @ingroup ResultCache
+ * @param exe_network A pointer to ie_executable_network_t instance.
+ * @param config A pointer to the cache configuration.
+ * @param cache A pointer to the newly created cache.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_result_cache_create(ie_executable_network_t *exe_network, \
+        const ie_result_cache_config_t *config, ie_result_cache_t **cache);
+
+/**
+ * @brief Releases the cache. The entries are freed once no infer request is attached to it any more.
+ * @ingroup ResultCache
+ * @param cache A pointer to the cache to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_result_cache_free(ie_result_cache_t **cache);
+
+/**
+ * @brief Removes all entries of the cache, for example after the model or its preprocessing changed.
+ * @ingroup ResultCache
+ * @param cache A pointer to ie_result_cache_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_result_cache_clear(ie_result_cache_t *cache);
+
+/**
+ * @brief Gets counters of the cache.
+ * @ingroup ResultCache
+ * @param cache A pointer to ie_result_cache_t instance.
+ * @param stats A pointer to the counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_result_cache_get_stats(ie_result_cache_t *cache, ie_result_cache_stats_t *stats);
+
+/**
+ * @brief Attaches the infer request to a result cache created for its executable network.
+ * @ingroup ResultCache
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param cache A pointer to ie_result_cache_t instance, NULL detaches the request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_result_cache(ie_infer_request_t *infer_request, \
+        ie_result_cache_t *cache);
+
+/** @} */ // end of ResultCache
+
+// FrameGate
+
+/**
+ * @defgroup FrameGate FrameGate
+ * Set of functions to skip inferences on video frames which barely differ from the last inferred frame, as from a
+ * fixed camera. With a gate attached, an infer request compares its input with the reference frame on
+ * ie_infer_request_infer() and ie_infer_request_infer_async(): the mean absolute or squared difference over every
+ * downsample-th row of the input, in the units of its U8 or FP32 elements. At or below the threshold the outputs of the
+ * reference are copied to the output blobs of the request and no inference runs; ie_infer_request_wait() returns OK at
+ * once and the completion callback runs on a thread of the gate. Otherwise the frame is inferred and becomes the new
+ * reference. A gate follows one stream of frames, with any number of infer requests.
+ * @{
+ */
+
+typedef struct ie_frame_gate ie_frame_gate_t;
+
+/**
+ * @enum frame_diff_metric_e
+ * @brief Difference between a frame and the reference frame.
+ */
+typedef enum {
+    FRAME_DIFF_SAD = 0,     // mean absolute difference of the elements
+    FRAME_DIFF_MSE = 1,     // mean squared difference of the elements
+}frame_diff_metric_e;
+
+/**
+ * @struct ie_frame_gate_config
+ * @brief Represents configuration of a frame gate.
+ */
+typedef struct ie_frame_gate_config {
+    const char *input_name;         // input holding the frame, NULL for the first input
+    frame_diff_metric_e metric;
+    size_t downsample;              // compare every downsample-th row of the frame, 0 or 1 compares all rows
+    double threshold;               // frames differing by at most this from the reference are skipped
+    size_t max_skip;                // frames skipped in a row before one is inferred anyway, 0 means no limit
+}ie_frame_gate_config_t;
+
+/**
+ * @struct ie_frame_gate_stats
+ * @brief Represents counters of a frame gate.
+ */
+typedef struct ie_frame_gate_stats {
+    uint64_t frames;        // submits of the attached infer requests
+    uint64_t inferred;
+    uint64_t skipped;
+    uint64_t forced;        // frames below the threshold inferred because of max_skip
+    uint64_t bypassed;      // frames without a plain U8 or FP32 buffer, inferred without comparison
+    double skip_rate;       // skipped / frames
+    double last_diff;       // difference of the last compared frame
+    double mean_diff;       // mean difference of the compared frames
+    double diff_ms;         // total time spent comparing frames
+}ie_frame_gate_stats_t;
+
+/**
+ * @brief Creates a frame gate for infer requests of the executable network. The input must have U8 or FP32 precision.
+ * Use the ie_frame_gate_free() method to free memory.
+ * @ingroup FrameGate
+ * @param exe_network A pointer to ie_executable_network_t instance.
+ * @param config A pointer to the gate configuration.
+ * @param gate A pointer to the newly created gate.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_frame_gate_create(ie_executable_network_t *exe_network, \
+        const ie_frame_gate_config_t *config, ie_frame_gate_t **gate);
+
+/**
+ * @brief Releases the gate. Its reference frame is freed once no infer request is attached to it any more.
+ * @ingroup FrameGate
+ * @param gate A pointer to the gate to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_frame_gate_free(ie_frame_gate_t **gate);
+
+/**
+ * @brief Drops the reference frame, so the next frame is inferred, for example after a scene cut or a camera switch.
+ * @ingroup FrameGate
+ * @param gate A pointer to ie_frame_gate_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_frame_gate_reset(ie_frame_gate_t *gate);
+
+/**
+ * @brief Gets counters of the gate.
+ * @ingroup FrameGate
+ * @param gate A pointer to ie_frame_gate_t instance.
+ * @param stats A pointer to the counters.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_frame_gate_get_stats(ie_frame_gate_t *gate, ie_frame_gate_stats_t *stats);
+
+/**
+ * @brief Attaches the infer request to a frame gate created for its executable network. The gate is checked before a
+ * result cache attached to the same request.
+ * @ingroup FrameGate
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param gate A pointer to ie_frame_gate_t instance, NULL detaches the request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_frame_gate(ie_infer_request_t *infer_request, \
+        ie_frame_gate_t *gate);
+
+/** @} */ // end of FrameGate
+
+// Tiler
+
+/**
+ * @defgroup Tiler Tiler
+ * Set of functions to run a network on images larger than its input, such as 4K or 8K frames. The image is split
+ * into overlapping tiles of the input size, the tiles fill the batch of the input and run on a pool of infer requests
+ * in flight, and their outputs are merged into one result for the image:
+ * - a DetectionOutput [1, 1, N, 7] output gives detections in pixels of the image, with the duplicates of objects seen
+ *   by overlapping tiles removed by non-maximum suppression per label;
+ * - a dense NCHW FP32 output, such as a segmentation map, is stitched into one output for the image, each tile
+ *   contributing the part of the image up to the middle of its overlaps.
+ * Images are U8 or FP32 NCHW or NHWC blobs with a batch of 1 and the channels of the input. An image smaller than the
+ * input along a side gives one tile padded with zeros.
+ * @{
+ */
+
+typedef struct ie_tiler ie_tiler_t;
+
+/**
+ * @struct ie_tiler_config
+ * @brief Represents configuration of a tiler.
+ */
+typedef struct ie_tiler_config {
+    const char *input_name;         // input the tiles are set to
+    const char *output_name;        // output merged for the image
+    size_t overlap;                 // pixels shared by neighbouring tiles, at least the size of the objects to detect
+    size_t num_requests;            // infer requests in flight, 0 for OPTIMAL_NUMBER_OF_INFER_REQUESTS of the network
+    float confidence_threshold;     // detections below are dropped
+    float nms_threshold;            // IoU above which the less confident of two detections is dropped, 1 disables it
+}ie_tiler_config_t;
+
+/**
+ * @struct ie_tiler_detection
+ * @brief Represents a detection in an image, in pixels.
+ */
+typedef struct ie_tiler_detection {
+    int label;
+    float confidence;
+    float x_min;
+    float y_min;
+    float x_max;
+    float y_max;
+}ie_tiler_detection_t;
+
+/**
+ * @struct ie_tiler_result
+ * @brief Represents the merged outputs of an image.
+ */
+typedef struct ie_tiler_result {
+    ie_tiler_detection_t *detections;   // by decreasing confidence, for a DetectionOutput output
+    size_t num_detections;
+    ie_blob_t *output;                  // [1, C, H * scale, W * scale] for a dense output, NULL otherwise
+    size_t num_tiles;
+    size_t num_inferences;
+    double duration_ms;
+}ie_tiler_result_t;
+
+/**
+ * @brief Creates a tiler with its infer requests for the executable network, which must outlive it.
+ * Use the ie_tiler_free() method to free memory.
+ * @ingroup Tiler
+ * @param exe_network A pointer to ie_executable_network_t instance.
+ * @param config A pointer to the tiler configuration.
+ * @param tiler A pointer to the newly created tiler.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED for an unsupported input or output,
+ * OUT_OF_BOUNDS if the overlap is not smaller than the height and width of the input.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_tiler_create(ie_executable_network_t *exe_network, \
+        const ie_tiler_config_t *config, ie_tiler_t **tiler);
+
+/**
+ * @brief Releases memory occupied by the tiler and its infer requests.
+ * @ingroup Tiler
+ * @param tiler A pointer to the tiler to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_tiler_free(ie_tiler_t **tiler);
+
+/**
+ * @brief Runs the network on all tiles of the image and merges their outputs. Concurrent runs of a tiler are serialized.
+ * Use the ie_tiler_result_free() method to free memory of the result.
+ * @ingroup Tiler
+ * @param tiler A pointer to ie_tiler_t instance.
+ * @param image A pointer to the image blob.
+ * @param result A pointer to the merged outputs.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_tiler_run(ie_tiler_t *tiler, const ie_blob_t *image, ie_tiler_result_t *result);
+
+/**
+ * @brief Releases memory occupied by the merged outputs.
+ * @ingroup Tiler
+ * @param result A pointer to the merged outputs to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_tiler_result_free(ie_tiler_result_t *result);
+
+/** @} */ // end of Tiler
+
+// PostProcessing
+
+/**
+ * @defgroup PostProcessing PostProcessing
+ * Set of functions to turn the outputs of detection networks, as given by ie_blob_get_cbuffer(), into detections:
+ * score filtering, box decoding, non-maximum suppression per label and top-K selection. Filtering and suppression use
+ * AVX2 where the CPU has it, and the items of a batch are processed on parallel threads. Results go to fixed-size
+ * structs, so the caller can keep them on the stack or reuse them across inferences without allocating.
+ * @{
+ */
+
+/**
+ * @brief Maximum number of detections of one image in ie_postproc_detections_t.
+ */
+#define IE_POSTPROC_MAX_DETECTIONS 256
+
+/**
+ * @enum postproc_format_e
+ * @brief Layout of the outputs of a detection network. Boxes are FP32, in the units of the network.
+ */
+typedef enum {
+    POSTPROC_DETECTION_OUTPUT = 0,  // DetectionOutput [1, 1, N, 7]: image_id, label, score, x_min, y_min, x_max, y_max
+    POSTPROC_BOXES_CORNERS = 1,     // boxes [B, N, 4] as x_min, y_min, x_max, y_max and scores [B, N, C]
+    POSTPROC_BOXES_CENTER_SIZE = 2, // boxes [B, N, 4] as center x, center y, width, height and scores [B, N, C]
+    POSTPROC_SSD_PRIORS = 3,        // SSD location deltas [B, N, 4], scores [B, N, C] and priors [N, 4] as corners
+    POSTPROC_YOLO = 4,              // YOLO [B, N, 5 + C]: center x, center y, width, height, objectness, class scores
+}postproc_format_e;
+
+/**
+ * @struct ie_postproc_tensors
+ * @brief Represents the outputs of a detection network.
+ */
+typedef struct ie_postproc_tensors {
+    postproc_format_e format;
+    size_t batch;               // items of the batch, results are given per item
+    size_t num_boxes;           // N, rows of the DetectionOutput
+    size_t num_classes;         // C, unused for POSTPROC_DETECTION_OUTPUT
+    const float *boxes;         // the DetectionOutput, the YOLO output, or the boxes
+    const float *scores;        // scores per box and class, NULL for POSTPROC_DETECTION_OUTPUT and POSTPROC_YOLO
+    const float *priors;        // prior boxes of POSTPROC_SSD_PRIORS, NULL otherwise
+}ie_postproc_tensors_t;
+
+/**
+ * @struct ie_postproc_config
+ * @brief Represents configuration of the post-processing.
+ */
+typedef struct ie_postproc_config {
+    float score_threshold;      // boxes and labels scoring below are dropped; for YOLO the score is objectness * class
+    float nms_threshold;        // IoU above which the less confident of two boxes of a label is dropped, 1 disables it
+    size_t top_k;               // detections kept per image, 0 or more than IE_POSTPROC_MAX_DETECTIONS keeps the maximum
+    size_t pre_nms_top_k;       // candidates per label going into the suppression, 0 keeps all
+    int background_label;       // label never reported, -1 for none
+    float variances[4];         // variances of the SSD priors, typically 0.1, 0.1, 0.2, 0.2
+    size_t num_threads;         // threads over the batch, 0 for the number of cores
+}ie_postproc_config_t;
+
+/**
+ * @struct ie_postproc_detection
+ * @brief Represents a detection.
+ */
+typedef struct ie_postproc_detection {
+    float x_min;
+    float y_min;
+    float x_max;
+    float y_max;
+    float score;
+    int32_t label;
+    uint32_t box_index;         // row of the box in the outputs
+}ie_postproc_detection_t;
+
+/**
+ * @struct ie_postproc_detections
+ * @brief Represents the detections of one image, by decreasing score.
+ */
+typedef struct ie_postproc_detections {
+    size_t count;
+    size_t num_candidates;      // boxes and labels above the score threshold, before suppression
+    ie_postproc_detection_t items[IE_POSTPROC_MAX_DETECTIONS];
+}ie_postproc_detections_t;
+
+/**
+ * @brief Gets the indices of the scores at or above the threshold, in increasing order.
+ * @ingroup PostProcessing
+ * @param scores A pointer to the scores.
+ * @param count Number of scores, at most UINT32_MAX.
+ * @param threshold Minimum score.
+ * @param indices A pointer to room for count indices.
+ * @param num_indices A pointer to the number of indices written.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_postproc_filter_scores(const float *scores, size_t count, float threshold, \
+        uint32_t *indices, size_t *num_indices);
+
+/**
+ * @brief Decodes boxes of POSTPROC_BOXES_CORNERS, POSTPROC_BOXES_CENTER_SIZE or POSTPROC_SSD_PRIORS to corners.
+ * @ingroup PostProcessing
+ * @param format Layout of the boxes.
+ * @param boxes A pointer to num_boxes boxes.
+ * @param num_boxes Number of boxes.
+ * @param priors A pointer to num_boxes prior boxes for POSTPROC_SSD_PRIORS, NULL otherwise.
+ * @param variances Variances of the priors for POSTPROC_SSD_PRIORS, NULL otherwise.
+ * @param corners A pointer to num_boxes boxes as x_min, y_min, x_max, y_max, which may be boxes.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_postproc_decode_boxes(postproc_format_e format, const float *boxes, \
+        size_t num_boxes, const float *priors, const float variances[4], float *corners);
+
+/**
+ * @brief Suppresses overlapping detections of the same label, keeping the most confident, and keeps the top_k.
+ * @ingroup PostProcessing
+ * @param detections A pointer to the detections, sorted by decreasing score on return.
+ * @param iou_threshold IoU above which the less confident detection is dropped.
+ * @param top_k Detections kept, 0 keeps all.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_postproc_nms(ie_postproc_detections_t *detections, float iou_threshold, \
+        size_t top_k);
+
+/**
+ * @brief Runs filtering, decoding, suppression and top-K selection on every item of the batch.
+ * @ingroup PostProcessing
+ * @param tensors A pointer to the outputs of the network.
+ * @param config A pointer to the post-processing configuration.
+ * @param results A pointer to tensors->batch results, one per item.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_postproc_detect(const ie_postproc_tensors_t *tensors, \
+        const ie_postproc_config_t *config, ie_postproc_detections_t *results);
+
+/**
+ * @struct ie_topk_entry
+ * @brief Represents a class and its score.
+ */
+typedef struct ie_topk_entry {
+    size_t index;       // index of the class among the elements of an item of the batch
+    float score;        // the output value, or its softmax probability
+}ie_topk_entry_t;
+
+/**
+ * @struct ie_topk_results
+ * @brief Represents the best classes of every item of a batch.
+ */
+typedef struct ie_topk_results {
+    ie_topk_entry_t *entries;   // k entries per item by decreasing score, item i starting at entries[i * k]
+    size_t batch;
+    size_t k;
+}ie_topk_results_t;
+
+/**
+ * @brief Gets the k best classes of every item of a classification output. The classes of an item are all its elements,
+ * so NC and NCHW outputs with spatial dimensions of 1 are handled alike. Selection keeps a heap of the k best and
+ * compares whole vectors of scores with the worst of them, without sorting the scores; with apply_softmax the scores
+ * returned are softmax probabilities over all classes of the item. Items of a large batch are processed on parallel
+ * threads. Use the ie_topk_results_free() method to free memory.
+ * @ingroup PostProcessing
+ * @param blob A pointer to an FP32 or FP16 output blob with the batch as first dimension.
+ * @param k Number of classes per item, at most the number of classes.
+ * @param apply_softmax Non-zero to return softmax probabilities instead of the output values.
+ * @param results A pointer to the best classes.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_topk(const ie_blob_t *blob, size_t k, int apply_softmax, \
+        ie_topk_results_t *results);
+
+/**
+ * @brief Releases memory occupied by the best classes.
+ * @ingroup PostProcessing
+ * @param results A pointer to the best classes to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_topk_results_free(ie_topk_results_t *results);
+
+/** @} */ // end of PostProcessing
+
 #endif  // IE_C_API_H
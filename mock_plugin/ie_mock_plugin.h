@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_mock_plugin.h
+ * Config keys and built-in model of the MOCK device, an in-process plugin which runs no
+ * computation. Its latency, failures and outputs are set through the config, so code built
+ * on the C API can be tested and benchmarked deterministically without a device or model files:
+ *
+ *     ie_core_register_plugin(core, "ie_mock_plugin", "MOCK");
+ *     ie_core_read_network_from_memory(core, (const uint8_t *)IE_MOCK_MODEL_XML, strlen(IE_MOCK_MODEL_XML), NULL, &network);
+ *     ie_core_load_network(core, network, "MOCK", &config, &exe_network);
+ *
+ * Keys are accepted by ie_core_set_config() for the device and by the config given when a
+ * network is loaded, which takes precedence.
+ */
+
+#ifndef IE_MOCK_PLUGIN_H
+#define IE_MOCK_PLUGIN_H
+
+/**
+ * @brief Latency of every inference in microseconds, "0" by default.
+ */
+#define IE_MOCK_LATENCY_US "MOCK_LATENCY_US"
+
+/**
+ * @brief Latency added per item of the batch in microseconds, "0" by default.
+ */
+#define IE_MOCK_LATENCY_PER_ITEM_US "MOCK_LATENCY_PER_ITEM_US"
+
+/**
+ * @brief Maximum random latency added to every inference in microseconds, "0" by default.
+ * The random sequence is reproducible for a given IE_MOCK_SEED.
+ */
+#define IE_MOCK_JITTER_US "MOCK_JITTER_US"
+
+/**
+ * @brief "YES" to busy-wait for the latency instead of sleeping, to occupy a core like a CPU plugin. "NO" by default.
+ */
+#define IE_MOCK_BUSY_WAIT "MOCK_BUSY_WAIT"
+
+/**
+ * @brief Every N-th inference of the executable network fails with GENERAL_ERROR, "0" disables failures.
+ */
+#define IE_MOCK_FAIL_EVERY "MOCK_FAIL_EVERY"
+
+/**
+ * @brief "YES" makes loading a network fail with GENERAL_ERROR. "NO" by default.
+ */
+#define IE_MOCK_FAIL_LOAD "MOCK_FAIL_LOAD"
+
+/**
+ * @brief Content of the outputs after an inference:
+ * "ZEROS" (default), "COPY" repeating the bytes of the first input, "INDEX" setting FP32 element i to i,
+ * "COUNTER" setting every FP32 element to the number of the inference and "RANDOM" for FP32 values in [0, 1).
+ */
+#define IE_MOCK_OUTPUT "MOCK_OUTPUT"
+
+/**
+ * @brief Seed of IE_MOCK_JITTER_US and of the "RANDOM" outputs, "0" by default.
+ */
+#define IE_MOCK_SEED "MOCK_SEED"
+
+/**
+ * @brief Number of inferences an executable network runs in parallel, "1" by default.
+ * Reported as OPTIMAL_NUMBER_OF_INFER_REQUESTS.
+ */
+#define IE_MOCK_STREAMS "MOCK_STREAMS"
+
+/**
+ * @brief A model with one FP32 NCHW input "data" of 1x3x8x8 and one output "relu" of the same shape. It has no weights.
+ */
+#define IE_MOCK_MODEL_XML \
+    "<?xml version=\"1.0\"?>\n" \
+    "<net name=\"mock\" version=\"10\">\n" \
+    "  <layers>\n" \
+    "    <layer id=\"0\" name=\"data\" type=\"Parameter\" version=\"opset1\">\n" \
+    "      <data element_type=\"f32\" shape=\"1,3,8,8\"/>\n" \
+    "      <output><port id=\"0\" precision=\"FP32\"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port></output>\n" \
+    "    </layer>\n" \
+    "    <layer id=\"1\" name=\"relu\" type=\"ReLU\" version=\"opset1\">\n" \
+    "      <input><port id=\"0\"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port></input>\n" \
+    "      <output><port id=\"1\" precision=\"FP32\"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port></output>\n" \
+    "    </layer>\n" \
+    "    <layer id=\"2\" name=\"output\" type=\"Result\" version=\"opset1\">\n" \
+    "      <input><port id=\"0\"><dim>1</dim><dim>3</dim><dim>8</dim><dim>8</dim></port></input>\n" \
+    "    </layer>\n" \
+    "  </layers>\n" \
+    "  <edges>\n" \
+    "    <edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"0\"/>\n" \
+    "    <edge from-layer=\"1\" from-port=\"1\" to-layer=\"2\" to-port=\"0\"/>\n" \
+    "  </edges>\n" \
+    "</net>\n"
+
+#endif  // IE_MOCK_PLUGIN_H
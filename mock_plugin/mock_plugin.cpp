@@ -0,0 +1,402 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blob_factory.hpp>
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+#include "ie_mock_plugin.h"
+
+namespace IE = InferenceEngine;
+
+namespace {
+
+enum class mock_output {
+    ZEROS,
+    COPY,
+    INDEX,
+    COUNTER,
+    RANDOM,
+};
+
+const std::map<std::string, mock_output> output_modes = {
+    {"ZEROS", mock_output::ZEROS},
+    {"COPY", mock_output::COPY},
+    {"INDEX", mock_output::INDEX},
+    {"COUNTER", mock_output::COUNTER},
+    {"RANDOM", mock_output::RANDOM},
+};
+
+/**
+ * @struct mock_config
+ * @brief Behaviour of the device, set from the IE_MOCK_* keys and the generic keys the C API relies on.
+ */
+struct mock_config {
+    uint64_t latency_us = 0;
+    uint64_t latency_per_item_us = 0;
+    uint64_t jitter_us = 0;
+    bool busy_wait = false;
+    uint64_t fail_every = 0;
+    bool fail_load = false;
+    mock_output output = mock_output::ZEROS;
+    uint64_t seed = 0;
+    unsigned int streams = 1;
+    bool perf_count = false;
+    bool dyn_batch = false;
+    int dyn_batch_limit = 0;
+
+    static std::vector<std::string> keys() {
+        return {IE_MOCK_LATENCY_US, IE_MOCK_LATENCY_PER_ITEM_US, IE_MOCK_JITTER_US, IE_MOCK_BUSY_WAIT, IE_MOCK_FAIL_EVERY,
+                IE_MOCK_FAIL_LOAD, IE_MOCK_OUTPUT, IE_MOCK_SEED, IE_MOCK_STREAMS, CONFIG_KEY(PERF_COUNT),
+                CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_KEY(DYN_BATCH_LIMIT)};
+    }
+
+    void set(const std::string &key, const std::string &value) {
+        auto number = [&]() -> uint64_t {
+            try {
+                size_t end = 0;
+                uint64_t result = std::stoull(value, &end);
+                if (end == value.size()) {
+                    return result;
+                }
+            } catch (...) {
+            }
+            THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::GENERAL_ERROR
+                               << "Invalid value " << value << " of " << key;
+        };
+        auto flag = [&]() {
+            if (value != CONFIG_VALUE(YES) && value != CONFIG_VALUE(NO)) {
+                THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::GENERAL_ERROR
+                                   << "Invalid value " << value << " of " << key;
+            }
+            return value == CONFIG_VALUE(YES);
+        };
+
+        if (key == IE_MOCK_LATENCY_US) {
+            latency_us = number();
+        } else if (key == IE_MOCK_LATENCY_PER_ITEM_US) {
+            latency_per_item_us = number();
+        } else if (key == IE_MOCK_JITTER_US) {
+            jitter_us = number();
+        } else if (key == IE_MOCK_BUSY_WAIT) {
+            busy_wait = flag();
+        } else if (key == IE_MOCK_FAIL_EVERY) {
+            fail_every = number();
+        } else if (key == IE_MOCK_FAIL_LOAD) {
+            fail_load = flag();
+        } else if (key == IE_MOCK_OUTPUT) {
+            auto mode = output_modes.find(value);
+            if (mode == output_modes.end()) {
+                THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::GENERAL_ERROR
+                                   << "Invalid value " << value << " of " << key;
+            }
+            output = mode->second;
+        } else if (key == IE_MOCK_SEED) {
+            seed = number();
+        } else if (key == IE_MOCK_STREAMS) {
+            streams = static_cast<unsigned int>(std::max<uint64_t>(number(), 1));
+        } else if (key == CONFIG_KEY(PERF_COUNT)) {
+            perf_count = flag();
+        } else if (key == CONFIG_KEY(DYN_BATCH_ENABLED)) {
+            dyn_batch = flag();
+        } else if (key == CONFIG_KEY(DYN_BATCH_LIMIT)) {
+            dyn_batch_limit = static_cast<int>(number());
+        } else {
+            THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::NOT_FOUND << "Unsupported config key " << key;
+        }
+    }
+
+    std::string get(const std::string &key) const {
+        auto yesNo = [](bool value) { return std::string(value ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)); };
+        if (key == IE_MOCK_LATENCY_US) {
+            return std::to_string(latency_us);
+        } else if (key == IE_MOCK_LATENCY_PER_ITEM_US) {
+            return std::to_string(latency_per_item_us);
+        } else if (key == IE_MOCK_JITTER_US) {
+            return std::to_string(jitter_us);
+        } else if (key == IE_MOCK_BUSY_WAIT) {
+            return yesNo(busy_wait);
+        } else if (key == IE_MOCK_FAIL_EVERY) {
+            return std::to_string(fail_every);
+        } else if (key == IE_MOCK_FAIL_LOAD) {
+            return yesNo(fail_load);
+        } else if (key == IE_MOCK_OUTPUT) {
+            for (const auto &mode : output_modes) {
+                if (mode.second == output) {
+                    return mode.first;
+                }
+            }
+        } else if (key == IE_MOCK_SEED) {
+            return std::to_string(seed);
+        } else if (key == IE_MOCK_STREAMS) {
+            return std::to_string(streams);
+        } else if (key == CONFIG_KEY(PERF_COUNT)) {
+            return yesNo(perf_count);
+        } else if (key == CONFIG_KEY(DYN_BATCH_ENABLED)) {
+            return yesNo(dyn_batch);
+        } else if (key == CONFIG_KEY(DYN_BATCH_LIMIT)) {
+            return std::to_string(dyn_batch_limit);
+        }
+        THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::NOT_FOUND << "Unsupported config key " << key;
+    }
+};
+
+/**
+ * @struct mock_network_state
+ * @brief State shared by an executable network and its infer requests.
+ */
+struct mock_network_state {
+    mock_config config;
+    std::string name;
+    std::atomic<uint64_t> inferences{0};
+};
+
+class MockInferRequest : public IE::InferRequestInternal {
+public:
+    MockInferRequest(const IE::InputsDataMap &networkInputs, const IE::OutputsDataMap &networkOutputs,
+                     const std::shared_ptr<mock_network_state> &state)
+        : IE::InferRequestInternal(networkInputs, networkOutputs), _state(state) {
+        for (const auto &input : _networkInputs) {
+            _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+        for (const auto &output : _networkOutputs) {
+            _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+            _outputs[output.first]->allocate();
+        }
+    }
+
+    void InferImpl() override {
+        const mock_config &config = _state->config;
+        uint64_t number = _state->inferences.fetch_add(1) + 1;
+        // seeded per inference, so jitter and outputs do not depend on which request or thread ran it
+        std::mt19937_64 random(config.seed ^ (number * 0x9E3779B97F4A7C15ull));
+
+        auto begin = std::chrono::steady_clock::now();
+        uint64_t latency_us = config.latency_us + config.latency_per_item_us * batch();
+        if (config.jitter_us) {
+            latency_us += random() % (config.jitter_us + 1);
+        }
+        auto end = begin + std::chrono::microseconds(latency_us);
+        if (config.busy_wait) {
+            while (std::chrono::steady_clock::now() < end) {
+            }
+        } else {
+            std::this_thread::sleep_until(end);
+        }
+        _last_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+        if (config.fail_every && number % config.fail_every == 0) {
+            THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::GENERAL_ERROR
+                               << "Mock failure of inference " << number;
+        }
+        writeOutputs(number, random);
+    }
+
+    void SetBatch(int batch) override {
+        const mock_config &config = _state->config;
+        if (!config.dyn_batch) {
+            THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::NOT_IMPLEMENTED << "Dynamic batch is not enabled";
+        }
+        if (batch < 1 || (config.dyn_batch_limit > 0 && batch > config.dyn_batch_limit)) {
+            THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::OUT_OF_BOUNDS << "Invalid batch " << batch;
+        }
+        m_curBatch = batch;
+    }
+
+    void GetPerformanceCounts(std::map<std::string, IE::InferenceEngineProfileInfo> &perfMap) const override {
+        perfMap.clear();
+        if (!_state->config.perf_count) {
+            return;
+        }
+        IE::InferenceEngineProfileInfo info = {};
+        info.status = IE::InferenceEngineProfileInfo::EXECUTED;
+        info.realTime_uSec = _last_us;
+        info.cpu_uSec = _state->config.busy_wait ? _last_us : 0;
+        strncpy(info.exec_type, "mock", sizeof(info.exec_type) - 1);
+        strncpy(info.layer_type, "Mock", sizeof(info.layer_type) - 1);
+        perfMap["mock"] = info;
+    }
+
+private:
+    size_t batch() const {
+        if (m_curBatch > 0) {
+            return static_cast<size_t>(m_curBatch);
+        }
+        if (_inputs.empty() || _inputs.begin()->second->getTensorDesc().getDims().empty()) {
+            return 1;
+        }
+        return _inputs.begin()->second->getTensorDesc().getDims()[0];
+    }
+
+    void writeOutputs(uint64_t number, std::mt19937_64 &random) {
+        const IE::Blob::Ptr source = _inputs.empty() ? nullptr : _inputs.begin()->second;
+        std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+        for (auto &output : _outputs) {
+            IE::Blob::Ptr &blob = output.second;
+            uint8_t *data = blob->buffer().as<uint8_t *>();
+            size_t bytes = blob->byteSize();
+            bool fp32 = blob->getTensorDesc().getPrecision() == IE::Precision::FP32;
+            float *values = reinterpret_cast<float *>(data);
+
+            switch (_state->config.output) {
+            case mock_output::COPY:
+                if (source && source->byteSize()) {
+                    const uint8_t *from = source->cbuffer().as<const uint8_t *>();
+                    for (size_t i = 0; i < bytes; i += source->byteSize()) {
+                        memcpy(data + i, from, std::min(source->byteSize(), bytes - i));
+                    }
+                    continue;
+                }
+                break;
+            case mock_output::INDEX:
+                if (fp32) {
+                    for (size_t i = 0; i < blob->size(); ++i) {
+                        values[i] = static_cast<float>(i);
+                    }
+                    continue;
+                }
+                break;
+            case mock_output::COUNTER:
+                if (fp32) {
+                    std::fill(values, values + blob->size(), static_cast<float>(number));
+                    continue;
+                }
+                break;
+            case mock_output::RANDOM:
+                if (fp32) {
+                    for (size_t i = 0; i < blob->size(); ++i) {
+                        values[i] = uniform(random);
+                    }
+                    continue;
+                }
+                break;
+            case mock_output::ZEROS:
+                break;
+            }
+            memset(data, 0, bytes);
+        }
+    }
+
+    std::shared_ptr<mock_network_state> _state;
+    long long _last_us = 0;
+};
+
+class MockExecutableNetwork : public IE::ExecutableNetworkThreadSafeDefault {
+public:
+    MockExecutableNetwork(const IE::ICNNNetwork &network, const mock_config &config)
+        : IE::ExecutableNetworkThreadSafeDefault(
+              std::make_shared<IE::CPUStreamsExecutor>(IE::IStreamsExecutor::Config{"MockStreams", static_cast<int>(config.streams)}),
+              std::make_shared<IE::CPUStreamsExecutor>(IE::IStreamsExecutor::Config{"MockCallbacks"})),
+          _state(std::make_shared<mock_network_state>()) {
+        _state->config = config;
+        _state->name = network.getName();
+    }
+
+    IE::InferRequestInternal::Ptr CreateInferRequestImpl(IE::InputsDataMap networkInputs,
+                                                         IE::OutputsDataMap networkOutputs) override {
+        return std::make_shared<MockInferRequest>(networkInputs, networkOutputs, _state);
+    }
+
+    IE::Parameter GetConfig(const std::string &name) const override {
+        return _state->config.get(name);
+    }
+
+    IE::Parameter GetMetric(const std::string &name) const override {
+        if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+            IE_SET_METRIC_RETURN(SUPPORTED_METRICS, std::vector<std::string>({METRIC_KEY(NETWORK_NAME),
+                METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS), METRIC_KEY(SUPPORTED_METRICS), METRIC_KEY(SUPPORTED_CONFIG_KEYS)}));
+        } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+            IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, mock_config::keys());
+        } else if (name == METRIC_KEY(NETWORK_NAME)) {
+            IE_SET_METRIC_RETURN(NETWORK_NAME, _state->name);
+        } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+            IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, _state->config.streams);
+        }
+        THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::NOT_FOUND << "Unsupported metric " << name;
+    }
+
+private:
+    std::shared_ptr<mock_network_state> _state;
+};
+
+class MockPlugin : public IE::InferencePluginInternal {
+public:
+    MockPlugin() {
+        _pluginName = "MOCK";
+    }
+
+    IE::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const IE::ICNNNetwork &network,
+                                                          const std::map<std::string, std::string> &config) override {
+        mock_config merged;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            merged = _config;
+        }
+        for (const auto &item : config) {
+            merged.set(item.first, item.second);
+        }
+        if (merged.fail_load) {
+            THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::GENERAL_ERROR << "Mock failure of loading";
+        }
+        return std::make_shared<MockExecutableNetwork>(network, merged);
+    }
+
+    void SetConfig(const std::map<std::string, std::string> &config) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        mock_config updated = _config;
+        for (const auto &item : config) {
+            updated.set(item.first, item.second);
+        }
+        _config = updated;
+    }
+
+    IE::Parameter GetConfig(const std::string &name, const std::map<std::string, IE::Parameter> & /*options*/) const override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _config.get(name);
+    }
+
+    IE::Parameter GetMetric(const std::string &name, const std::map<std::string, IE::Parameter> & /*options*/) const override {
+        if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+            IE_SET_METRIC_RETURN(SUPPORTED_METRICS, std::vector<std::string>({METRIC_KEY(AVAILABLE_DEVICES),
+                METRIC_KEY(FULL_DEVICE_NAME), METRIC_KEY(OPTIMIZATION_CAPABILITIES), METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
+                METRIC_KEY(SUPPORTED_METRICS), METRIC_KEY(SUPPORTED_CONFIG_KEYS)}));
+        } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+            IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, mock_config::keys());
+        } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
+            IE_SET_METRIC_RETURN(AVAILABLE_DEVICES, std::vector<std::string>({""}));
+        } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+            IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, std::string("Mock device"));
+        } else if (name == METRIC_KEY(OPTIMIZATION_CAPABILITIES)) {
+            IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, std::vector<std::string>({METRIC_VALUE(FP32), METRIC_VALUE(FP16)}));
+        } else if (name == METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS)) {
+            IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, std::make_tuple(1u, 64u, 1u));
+        }
+        THROW_IE_EXCEPTION << IE::details::as_status << IE::StatusCode::NOT_FOUND << "Unsupported metric " << name;
+    }
+
+private:
+    mutable std::mutex _mutex;
+    mock_config _config;
+};
+
+const IE::Version version = {{2, 1}, "mock", "ieMockPlugin"};
+
+}  // namespace
+
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(MockPlugin, version)
@@ -0,0 +1,550 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <map>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <condition_variable>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+typedef std::map<std::string, std::vector<size_t>> shape_map;
+
+/**
+ * @struct shape_bucket
+ * @brief An executable network compiled for one set of input shapes and its pool of infer requests.
+ */
+struct shape_bucket {
+    shape_map shapes;
+    size_t elements = 0;
+    ie_executable_network_t *exe_network = nullptr;
+    std::vector<ie_infer_request_t *> requests;
+    std::vector<ie_infer_request_t *> idle;
+};
+
+/**
+ *@brief number of elements of all inputs, or of the inputs listed in `only` if given.
+ */
+size_t countElements(const shape_map &shapes, const shape_map &only = shape_map()) {
+    size_t total = 0;
+    for (const auto &it : shapes) {
+        if (!only.empty() && !only.count(it.first)) {
+            continue;
+        }
+        size_t n = 1;
+        for (size_t d : it.second) {
+            n *= d;
+        }
+        total += n;
+    }
+    return total;
+}
+
+void freeBucket(shape_bucket &bucket) {
+    for (auto &request : bucket.requests) {
+        ie_infer_request_free(&request);
+    }
+    bucket.requests.clear();
+    bucket.idle.clear();
+    ie_exec_network_free(&bucket.exe_network);
+}
+
+/**
+ *@brief order in which the dimensions of a blob are laid out in memory.
+ */
+std::vector<size_t> memoryOrder(layout_e layout, size_t rank) {
+    if (layout == layout_e::NHWC && rank == 4) {
+        return {0, 2, 3, 1};
+    }
+    if (layout == layout_e::NDHWC && rank == 5) {
+        return {0, 2, 3, 4, 1};
+    }
+    std::vector<size_t> order(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        order[i] = i;
+    }
+    return order;
+}
+
+/**
+ *@brief copies `src` into the top-left corner of the larger `dst` and zeroes the rest.
+ */
+IEStatusCode padCopy(ie_blob_t *src, ie_blob_t *dst) {
+    dimensions_t src_dims, dst_dims;
+    precision_e src_prec, dst_prec;
+    layout_e src_layout, dst_layout;
+    IEStatusCode status = ie_blob_get_dims(src, &src_dims);
+    if (status == IEStatusCode::OK) status = ie_blob_get_dims(dst, &dst_dims);
+    if (status == IEStatusCode::OK) status = ie_blob_get_precision(src, &src_prec);
+    if (status == IEStatusCode::OK) status = ie_blob_get_precision(dst, &dst_prec);
+    if (status == IEStatusCode::OK) status = ie_blob_get_layout(src, &src_layout);
+    if (status == IEStatusCode::OK) status = ie_blob_get_layout(dst, &dst_layout);
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+    if (src_prec != dst_prec || src_layout != dst_layout || src_dims.ranks != dst_dims.ranks || src_dims.ranks == 0) {
+        return IEStatusCode::PARAMETER_MISMATCH;
+    }
+
+    int elements = 0, bytes = 0;
+    ie_blob_buffer_t src_buf, dst_buf;
+    status = ie_blob_size(dst, &elements);
+    if (status == IEStatusCode::OK) status = ie_blob_byte_size(dst, &bytes);
+    if (status == IEStatusCode::OK) status = ie_blob_get_cbuffer(src, &src_buf);
+    if (status == IEStatusCode::OK) status = ie_blob_get_buffer(dst, &dst_buf);
+    if (status != IEStatusCode::OK || elements == 0) {
+        return status;
+    }
+    size_t elem_size = static_cast<size_t>(bytes / elements);
+
+    // dimensions in memory order, the innermost one is copied as a row
+    std::vector<size_t> order = memoryOrder(src_layout, src_dims.ranks);
+    size_t rank = order.size();
+    std::vector<size_t> s(rank), d(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        s[i] = src_dims.dims[order[i]];
+        d[i] = dst_dims.dims[order[i]];
+        if (s[i] > d[i]) {
+            return IEStatusCode::OUT_OF_BOUNDS;
+        }
+    }
+
+    const uint8_t *from = static_cast<const uint8_t *>(src_buf.cbuffer);
+    uint8_t *to = static_cast<uint8_t *>(dst_buf.buffer);
+    memset(to, 0, static_cast<size_t>(bytes));
+
+    size_t rows = 1;
+    for (size_t i = 0; i + 1 < rank; ++i) {
+        rows *= s[i];
+    }
+    size_t row_bytes = s[rank - 1] * elem_size;
+    std::vector<size_t> index(rank, 0);
+    for (size_t r = 0; r < rows; ++r) {
+        size_t offset = 0;
+        for (size_t i = 0; i + 1 < rank; ++i) {
+            offset = offset * d[i] + index[i];
+        }
+        memcpy(to + offset * d[rank - 1] * elem_size, from + r * row_bytes, row_bytes);
+        for (size_t i = rank - 1; i-- > 0;) {
+            if (++index[i] < s[i]) {
+                break;
+            }
+            index[i] = 0;
+        }
+    }
+    return IEStatusCode::OK;
+}
+
+}  // namespace
+
+/**
+ * @struct ie_bucket_set
+ * @brief Networks of one model compiled for several input shapes, with background compilation of new shapes.
+ */
+struct ie_bucket_set {
+    ie_core_t *core = nullptr;
+    std::string device_name;
+    owned_config config;
+    size_t max_buckets = 0;
+    size_t round_to = 1;
+    double min_fill = 0.0;
+    size_t requests_per_bucket = 1;
+
+    // the network is reshaped for every compilation, only the compiler uses it after creation
+    ie_network_t *network = nullptr;
+    shape_map original;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<shape_bucket>> buckets;
+    std::map<ie_infer_request_t *, shape_bucket *> owner;
+    std::deque<shape_map> pending;
+    std::vector<shape_map> failed;
+    std::thread compiler;
+    bool compiling = false;
+};
+
+namespace {
+
+IEStatusCode compileBucket(ie_bucket_set *set, const shape_map &shapes, std::unique_ptr<shape_bucket> &bucket) {
+    std::vector<input_shape_t> list;
+    for (const auto &it : shapes) {
+        input_shape_t shape;
+        shape.name = const_cast<char *>(it.first.c_str());
+        shape.shape.ranks = it.second.size();
+        std::copy(it.second.begin(), it.second.end(), shape.shape.dims);
+        list.push_back(shape);
+    }
+    input_shapes_t input_shapes = {list.data(), list.size()};
+    IEStatusCode status = ie_network_reshape(set->network, input_shapes);
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+
+    bucket.reset(new shape_bucket);
+    bucket->shapes = shapes;
+    bucket->elements = countElements(shapes);
+    status = ie_core_load_network(set->core, set->network, set->device_name.c_str(), set->config.list(), &bucket->exe_network);
+    for (size_t i = 0; i < set->requests_per_bucket && status == IEStatusCode::OK; ++i) {
+        ie_infer_request_t *request = nullptr;
+        status = ie_exec_network_create_infer_request(bucket->exe_network, &request);
+        if (status == IEStatusCode::OK) {
+            bucket->requests.push_back(request);
+        }
+    }
+    if (status != IEStatusCode::OK) {
+        freeBucket(*bucket);
+        bucket.reset();
+        return status;
+    }
+    bucket->idle = bucket->requests;
+    return IEStatusCode::OK;
+}
+
+void addBucket(ie_bucket_set *set, std::unique_ptr<shape_bucket> bucket) {
+    for (auto request : bucket->requests) {
+        set->owner[request] = bucket.get();
+    }
+    set->buckets.push_back(std::move(bucket));
+}
+
+void runCompiler(ie_bucket_set *set) {
+    std::unique_lock<std::mutex> lock(set->mutex);
+    while (!set->pending.empty()) {
+        shape_map shapes = set->pending.front();
+        lock.unlock();
+
+        std::unique_ptr<shape_bucket> bucket;
+        IEStatusCode status = IEStatusCode::UNEXPECTED;
+        try {
+            status = compileBucket(set, shapes, bucket);
+        } catch (...) {
+        }
+
+        lock.lock();
+        set->pending.pop_front();
+        if (status == IEStatusCode::OK) {
+            addBucket(set, std::move(bucket));
+        } else {
+            // remember the shape so that requests waiting for it fail instead of retrying forever
+            set->failed.push_back(shapes);
+        }
+        set->cv.notify_all();
+    }
+    set->compiling = false;
+}
+
+/**
+ *@brief queues a shape for compilation, the caller holds the lock.
+ */
+void requestBucket(ie_bucket_set *set, const shape_map &shapes) {
+    if (std::find(set->pending.begin(), set->pending.end(), shapes) != set->pending.end() ||
+        std::find(set->failed.begin(), set->failed.end(), shapes) != set->failed.end() ||
+        set->buckets.size() + set->pending.size() >= set->max_buckets) {
+        return;
+    }
+    set->pending.push_back(shapes);
+    if (!set->compiling) {
+        // the previous compiler has emptied the queue and only has to exit
+        if (set->compiler.joinable()) {
+            set->compiler.join();
+        }
+        set->compiling = true;
+        set->compiler = std::thread(runCompiler, set);
+    }
+}
+
+/**
+ *@brief the smallest bucket every input fits in, nullptr if there is none.
+ */
+shape_bucket *findBucket(ie_bucket_set *set, const shape_map &actual) {
+    shape_bucket *best = nullptr;
+    for (auto &bucket : set->buckets) {
+        bool fits = true;
+        for (const auto &it : actual) {
+            auto shape = bucket->shapes.find(it.first);
+            if (shape == bucket->shapes.end() || shape->second.size() != it.second.size()) {
+                fits = false;
+                break;
+            }
+            for (size_t i = 0; i < it.second.size() && fits; ++i) {
+                fits = it.second[i] <= shape->second[i];
+            }
+        }
+        if (fits && (best == nullptr || bucket->elements < best->elements)) {
+            best = bucket.get();
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+IEStatusCode ie_bucket_set_create(ie_core_t *core, const char *xml, const char *weights_file, \
+        const ie_bucket_set_config_t *config, ie_bucket_set_t **bucket_set) {
+    if (core == nullptr || xml == nullptr || config == nullptr || config->device_name == nullptr || bucket_set == nullptr ||
+        (config->num_buckets && config->buckets == nullptr)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_bucket_set_t> set(new ie_bucket_set_t);
+        set->core = core;
+        set->device_name = config->device_name;
+        set->max_buckets = config->max_buckets;
+        set->round_to = std::max<size_t>(config->round_to, 1);
+        set->min_fill = config->min_fill;
+        set->requests_per_bucket = std::max<size_t>(config->requests_per_bucket, 1);
+        set->config.assign(config->config);
+
+        IEStatusCode status = ie_core_read_network(core, xml, weights_file, &set->network);
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+        input_shapes_t shapes;
+        status = ie_network_get_input_shapes(set->network, &shapes);
+        if (status != IEStatusCode::OK) {
+            ie_network_free(&set->network);
+            return status;
+        }
+        for (size_t i = 0; i < shapes.shape_num; ++i) {
+            const dimensions_t &dims = shapes.shapes[i].shape;
+            set->original[shapes.shapes[i].name].assign(dims.dims, dims.dims + dims.ranks);
+        }
+        ie_network_input_shapes_free(&shapes);
+
+        std::vector<shape_map> initial;
+        for (size_t b = 0; b < config->num_buckets; ++b) {
+            // inputs not listed keep the shape of the IR
+            shape_map bucket_shapes = set->original;
+            for (size_t i = 0; i < config->buckets[b].shape_num; ++i) {
+                const input_shape_t &shape = config->buckets[b].shapes[i];
+                bucket_shapes[shape.name].assign(shape.shape.dims, shape.shape.dims + shape.shape.ranks);
+            }
+            initial.push_back(bucket_shapes);
+        }
+        if (initial.empty()) {
+            initial.push_back(set->original);
+        }
+
+        for (const auto &bucket_shapes : initial) {
+            std::unique_ptr<shape_bucket> bucket;
+            status = compileBucket(set.get(), bucket_shapes, bucket);
+            if (status != IEStatusCode::OK) {
+                for (auto &b : set->buckets) {
+                    freeBucket(*b);
+                }
+                ie_network_free(&set->network);
+                return status;
+            }
+            addBucket(set.get(), std::move(bucket));
+        }
+        set->max_buckets = std::max(set->max_buckets, set->buckets.size());
+
+        *bucket_set = set.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_bucket_set_free(ie_bucket_set_t **bucket_set) {
+    if (bucket_set == nullptr || *bucket_set == nullptr) {
+        return;
+    }
+
+    ie_bucket_set_t *set = *bucket_set;
+    {
+        std::lock_guard<std::mutex> lock(set->mutex);
+        // compilations which have not started are dropped
+        if (set->pending.size() > 1) {
+            set->pending.resize(1);
+        }
+    }
+    if (set->compiler.joinable()) {
+        set->compiler.join();
+    }
+    for (auto &bucket : set->buckets) {
+        freeBucket(*bucket);
+    }
+    ie_network_free(&set->network);
+    delete set;
+    *bucket_set = NULL;
+}
+
+IEStatusCode ie_bucket_set_acquire_request(ie_bucket_set_t *bucket_set, const ie_named_blob_t *inputs, \
+        size_t num_inputs, const int64_t timeout, ie_infer_request_t **request, size_t *bucket) {
+    if (bucket_set == nullptr || inputs == nullptr || num_inputs == 0 || request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        shape_map actual, wanted;
+        for (size_t i = 0; i < num_inputs; ++i) {
+            dimensions_t dims;
+            if (inputs[i].name == nullptr || inputs[i].blob == nullptr) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            IEStatusCode status = ie_blob_get_dims(inputs[i].blob, &dims);
+            if (status != IEStatusCode::OK) {
+                return status;
+            }
+            auto original = bucket_set->original.find(inputs[i].name);
+            if (original == bucket_set->original.end()) {
+                return IEStatusCode::NOT_FOUND;
+            }
+
+            std::vector<size_t> &shape = actual[inputs[i].name];
+            shape.assign(dims.dims, dims.dims + dims.ranks);
+            // only the dimensions which vary are rounded, fixed ones such as channels must stay as they are
+            std::vector<size_t> &rounded = wanted[inputs[i].name];
+            rounded = shape;
+            for (size_t d = 0; d < rounded.size() && d < original->second.size(); ++d) {
+                if (rounded[d] != original->second[d]) {
+                    rounded[d] = (rounded[d] + bucket_set->round_to - 1) / bucket_set->round_to * bucket_set->round_to;
+                }
+            }
+        }
+        for (const auto &it : bucket_set->original) {
+            if (!wanted.count(it.first)) {
+                wanted[it.first] = it.second;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(bucket_set->mutex);
+        shape_bucket *chosen = findBucket(bucket_set, actual);
+        bool learn = bucket_set->max_buckets > bucket_set->buckets.size() || !bucket_set->pending.empty();
+        if (chosen == nullptr) {
+            if (!learn) {
+                return IEStatusCode::OUT_OF_BOUNDS;
+            }
+            requestBucket(bucket_set, wanted);
+            auto queued = [&] { return std::find(bucket_set->pending.begin(), bucket_set->pending.end(), wanted) != bucket_set->pending.end(); };
+            if (!queued()) {
+                // the limit of buckets is reached or this shape failed to compile before
+                return IEStatusCode::OUT_OF_BOUNDS;
+            }
+            bucket_set->cv.wait(lock, [&] {
+                chosen = findBucket(bucket_set, actual);
+                return chosen != nullptr || !queued();
+            });
+            if (chosen == nullptr) {
+                return IEStatusCode::NETWORK_NOT_LOADED;
+            }
+        } else if (learn && static_cast<double>(countElements(actual)) < bucket_set->min_fill * countElements(chosen->shapes, actual)) {
+            // serve the request padded now, later ones of this shape get a tighter bucket
+            requestBucket(bucket_set, wanted);
+        }
+
+        auto available = [chosen] { return !chosen->idle.empty(); };
+        if (timeout < 0) {
+            bucket_set->cv.wait(lock, available);
+        } else if (!bucket_set->cv.wait_for(lock, std::chrono::milliseconds(timeout), available)) {
+            return IEStatusCode::REQUEST_BUSY;
+        }
+        ie_infer_request_t *taken = chosen->idle.back();
+        chosen->idle.pop_back();
+        if (bucket) {
+            for (size_t b = 0; b < bucket_set->buckets.size(); ++b) {
+                if (bucket_set->buckets[b].get() == chosen) {
+                    *bucket = b;
+                }
+            }
+        }
+        lock.unlock();
+
+        IEStatusCode status = IEStatusCode::OK;
+        for (size_t i = 0; i < num_inputs && status == IEStatusCode::OK; ++i) {
+            ie_blob_t *dst = nullptr;
+            status = ie_infer_request_get_blob(taken, inputs[i].name, &dst);
+            if (status == IEStatusCode::OK) {
+                status = padCopy(inputs[i].blob, dst);
+                ie_blob_free(&dst);
+            }
+        }
+        if (status != IEStatusCode::OK) {
+            lock.lock();
+            chosen->idle.push_back(taken);
+            bucket_set->cv.notify_all();
+            return status;
+        }
+        *request = taken;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_bucket_set_release_request(ie_bucket_set_t *bucket_set, ie_infer_request_t *request) {
+    if (bucket_set == nullptr || request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(bucket_set->mutex);
+        auto it = bucket_set->owner.find(request);
+        if (it == bucket_set->owner.end()) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        it->second->idle.push_back(request);
+    }
+    // waiters of different buckets share the condition variable
+    bucket_set->cv.notify_all();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_bucket_set_get_buckets_number(ie_bucket_set_t *bucket_set, size_t *size_result) {
+    if (bucket_set == nullptr || size_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(bucket_set->mutex);
+    *size_result = bucket_set->buckets.size();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_bucket_set_get_bucket_shapes(ie_bucket_set_t *bucket_set, size_t bucket, input_shapes_t *shapes) {
+    if (bucket_set == nullptr || shapes == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(bucket_set->mutex);
+        if (bucket >= bucket_set->buckets.size()) {
+            return IEStatusCode::OUT_OF_BOUNDS;
+        }
+
+        const shape_map &bucket_shapes = bucket_set->buckets[bucket]->shapes;
+        std::unique_ptr<input_shape_t[]> shape_ptrs(new input_shape_t[bucket_shapes.size()]);
+        size_t i = 0;
+        for (const auto &it : bucket_shapes) {
+            std::unique_ptr<char[]> name(new char[it.first.length() + 1]);
+            memcpy(name.get(), it.first.c_str(), it.first.length() + 1);
+            shape_ptrs[i].name = name.release();
+            shape_ptrs[i].shape.ranks = it.second.size();
+            std::copy(it.second.begin(), it.second.end(), shape_ptrs[i].shape.dims);
+            ++i;
+        }
+        shapes->shape_num = bucket_shapes.size();
+        shapes->shapes = shape_ptrs.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
@@ -14,20 +14,436 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <random>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <deque>
+#include <unordered_map>
+#include <condition_variable>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
 #include "ie_compound_blob.h"
 #include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#endif
 
 namespace IE = InferenceEngine;
 
+enum mem_kind {
+    MEM_CORE, MEM_NETWORK, MEM_EXECUTABLE, MEM_REQUEST, MEM_BLOB, MEM_KINDS
+};
+
+enum mem_data {
+    MEM_DATA_NONE, MEM_DATA_BLOB, MEM_DATA_REQUEST_BLOBS, MEM_DATA_LOAD, MEM_DATAS
+};
+
+enum mem_site {
+    SITE_CORE_CREATE, SITE_READ_NETWORK, SITE_LOAD_NETWORK, SITE_IMPORT_NETWORK, SITE_CREATE_INFER_REQUEST,
+    SITE_INFER_REQUEST_GET_BLOB, SITE_BLOB_MAKE_MEMORY, SITE_BLOB_MAKE_PREALLOCATED, SITE_BLOB_MAKE_ROI,
+    SITE_BLOB_MAKE_NV12, SITE_BLOB_MAKE_I420, SITES
+};
+
+/**
+ * @struct mem_shard
+ * @brief Memory statistics counted by the threads using the shard, one at a time. Only the owning thread writes,
+ * with a relaxed load and store rather than a read-modify-write, and shards are padded to their own cache lines,
+ * so creating and freeing objects on many threads shares no writes. Counts are signed: an object may be freed on
+ * another thread than the one which created it, only the sum over the shards is meaningful.
+ */
+struct mem_shard {
+    char padding_begin[64];
+    std::atomic<int64_t> objects[MEM_KINDS];
+    std::atomic<int64_t> wrapper_bytes;
+    std::atomic<int64_t> data[MEM_DATAS];
+    std::atomic<int64_t> allocations[SITES];
+    std::atomic<int64_t> frees[SITES];
+    std::atomic<int64_t> live_bytes[SITES];
+    bool shared = false;  // written by any thread, with read-modify-writes
+    char padding_end[64];
+
+    mem_shard() {
+        for (auto &counter : objects) counter.store(0, std::memory_order_relaxed);
+        wrapper_bytes.store(0, std::memory_order_relaxed);
+        for (auto &counter : data) counter.store(0, std::memory_order_relaxed);
+        for (auto &counter : allocations) counter.store(0, std::memory_order_relaxed);
+        for (auto &counter : frees) counter.store(0, std::memory_order_relaxed);
+        for (auto &counter : live_bytes) counter.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @struct mem_shards
+ * @brief Shards of every thread which has counted. The shard of an exiting thread is kept with its counts and
+ * handed to the next new thread, so the number of shards is bounded by the number of concurrent threads.
+ * Objects freed once the thread has given its shard back, by later thread_local or static destructors, count
+ * in the shared overflow shard.
+ */
+struct mem_shards {
+    std::mutex mutex;
+    std::vector<mem_shard *> all;
+    std::vector<mem_shard *> unused;
+    mem_shard overflow;
+
+    mem_shards() {
+        overflow.shared = true;
+        all.push_back(&overflow);
+    }
+};
+
+// never destroyed, so that objects freed by static destructors and exiting threads can still count
+mem_shards &memShards() {
+    static mem_shards *shards = new mem_shards;
+    return *shards;
+}
+
+// trivially destructible, so still valid while the thread_local objects of the thread are destroyed
+thread_local mem_shard *thread_shard = nullptr;
+thread_local bool thread_shard_released = false;
+
+struct mem_shard_owner {
+    ~mem_shard_owner() {
+        if (thread_shard) {
+            mem_shards &shards = memShards();
+            std::lock_guard<std::mutex> lock(shards.mutex);
+            shards.unused.push_back(thread_shard);
+        }
+        // another thread may take the shard from now on
+        thread_shard = nullptr;
+        thread_shard_released = true;
+    }
+};
+
+/**
+ *@brief the shard of the calling thread, taken on first use. The overflow shard once the thread gave its own back.
+ */
+mem_shard &memShard() {
+    if (thread_shard) {
+        return *thread_shard;
+    }
+    mem_shards &shards = memShards();
+    if (thread_shard_released) {
+        return shards.overflow;
+    }
+    thread_local mem_shard_owner owner;
+    std::lock_guard<std::mutex> lock(shards.mutex);
+    if (shards.unused.empty()) {
+        shards.all.push_back(new mem_shard);
+        thread_shard = shards.all.back();
+    } else {
+        thread_shard = shards.unused.back();
+        shards.unused.pop_back();
+    }
+    return *thread_shard;
+}
+
+inline void memAdd(mem_shard &shard, std::atomic<int64_t> &counter, int64_t delta) {
+    if (shard.shared) {
+        counter.fetch_add(delta, std::memory_order_relaxed);
+    } else {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @struct mem_tracker
+ * @brief Accounts one wrapper object and the memory attributed to it for as long as the object lives.
+ */
+struct mem_tracker {
+    mem_kind kind;
+    mem_site site;
+    size_t wrapper_bytes;
+    mem_data data = MEM_DATA_NONE;
+    size_t data_bytes = 0;
+
+    mem_tracker(mem_kind kind, mem_site site, size_t wrapper_bytes): kind(kind), site(site), wrapper_bytes(wrapper_bytes) {
+        mem_shard &shard = memShard();
+        memAdd(shard, shard.objects[kind], 1);
+        memAdd(shard, shard.wrapper_bytes, wrapper_bytes);
+        memAdd(shard, shard.allocations[site], 1);
+        memAdd(shard, shard.live_bytes[site], wrapper_bytes);
+    }
+
+    ~mem_tracker() {
+        mem_shard &shard = memShard();
+        setData(MEM_DATA_NONE, 0);
+        memAdd(shard, shard.objects[kind], -1);
+        memAdd(shard, shard.wrapper_bytes, -static_cast<int64_t>(wrapper_bytes));
+        memAdd(shard, shard.frees[site], 1);
+        memAdd(shard, shard.live_bytes[site], -static_cast<int64_t>(wrapper_bytes));
+    }
+
+    mem_tracker(const mem_tracker &) = delete;
+    mem_tracker &operator=(const mem_tracker &) = delete;
+
+    /**
+     *@brief attributes the object to the entry point which created it, when it differs from the default one.
+     */
+    void setSite(mem_site new_site) {
+        mem_shard &shard = memShard();
+        int64_t bytes = static_cast<int64_t>(wrapper_bytes + data_bytes);
+        memAdd(shard, shard.allocations[site], -1);
+        memAdd(shard, shard.live_bytes[site], -bytes);
+        site = new_site;
+        memAdd(shard, shard.allocations[site], 1);
+        memAdd(shard, shard.live_bytes[site], bytes);
+    }
+
+    void setData(mem_data new_data, size_t bytes) {
+        if (data == MEM_DATA_NONE && new_data == MEM_DATA_NONE) {
+            return;
+        }
+        mem_shard &shard = memShard();
+        if (data != MEM_DATA_NONE) {
+            memAdd(shard, shard.data[data], -static_cast<int64_t>(data_bytes));
+        }
+        memAdd(shard, shard.live_bytes[site], -static_cast<int64_t>(data_bytes));
+        data = new_data;
+        data_bytes = new_data == MEM_DATA_NONE ? 0 : bytes;
+        if (data != MEM_DATA_NONE) {
+            memAdd(shard, shard.data[data], data_bytes);
+        }
+        memAdd(shard, shard.live_bytes[site], data_bytes);
+    }
+};
+
+/**
+ * @struct exec_memory
+ * @brief Memory of the infer requests of one executable network.
+ */
+struct exec_memory {
+    std::atomic<size_t> num_requests{0};
+    std::atomic<size_t> request_blob_bytes{0};
+    std::mutex mutex;
+    std::map<std::string, size_t> port_bytes;  // bytes of every input and output blob of one request
+};
+
+/**
+ * @struct trace_event
+ * @brief One span recorded by the tracer.
+ */
+struct trace_event {
+    const char *name;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    uint64_t request_id;
+};
+
+/**
+ * @struct trace_buffer
+ * @brief Events of one thread. Only the owning thread appends, publishing each event with a release store of
+ * the count, so recording takes no lock and the writer of the trace reads the published prefix.
+ */
+struct trace_buffer {
+    std::vector<trace_event> events;
+    std::atomic<size_t> count{0};
+    std::atomic<size_t> dropped{0};
+    std::atomic<uint64_t> session{0};
+    uint64_t tid = 0;
+};
+
+/**
+ * @struct trace_state
+ * @brief Process-wide tracer. Recording is off unless ie_trace_start() was called.
+ */
+struct trace_state {
+    std::atomic<bool> enabled{false};
+    std::atomic<uint64_t> session{0};
+    size_t capacity = 0;
+    uint64_t origin_ns = 0;
+    std::mutex mutex;
+    std::vector<std::shared_ptr<trace_buffer>> buffers;
+};
+
+static trace_state tracer;
+
+static std::atomic<uint64_t> next_request_id{0};
+
+uint64_t traceNow() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ *@brief the buffer of the calling thread, registered on first use and reset on the first use of every session.
+ */
+trace_buffer *traceBuffer() {
+    thread_local std::shared_ptr<trace_buffer> local;
+    if (!local) {
+        local = std::make_shared<trace_buffer>();
+#ifdef __linux__
+        local->tid = static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+        local->tid = std::hash<std::thread::id>()(std::this_thread::get_id());
+#endif
+        std::lock_guard<std::mutex> lock(tracer.mutex);
+        tracer.buffers.push_back(local);
+    }
+
+    uint64_t session = tracer.session.load(std::memory_order_acquire);
+    if (local->session.load(std::memory_order_relaxed) != session) {
+        local->count.store(0, std::memory_order_relaxed);
+        local->dropped.store(0, std::memory_order_relaxed);
+        local->events.resize(tracer.capacity);
+        local->session.store(session, std::memory_order_release);
+    }
+    return local.get();
+}
+
+void traceRecord(const char *name, uint64_t begin_ns, uint64_t end_ns, uint64_t request_id) {
+    if (!tracer.enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    trace_buffer *buffer = traceBuffer();
+    size_t n = buffer->count.load(std::memory_order_relaxed);
+    if (n >= buffer->events.size()) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer->events[n] = trace_event{name, begin_ns, end_ns, request_id};
+    buffer->count.store(n + 1, std::memory_order_release);
+}
+
+/**
+ * @struct trace_span
+ * @brief Records the lifetime of the object as a span when tracing is enabled. Costs one relaxed load otherwise.
+ */
+struct trace_span {
+    const char *name;
+    uint64_t request_id;
+    uint64_t begin_ns = 0;
+
+    explicit trace_span(const char *name, uint64_t request_id = 0): name(name), request_id(request_id) {
+        if (tracer.enabled.load(std::memory_order_relaxed)) {
+            begin_ns = traceNow();
+        }
+    }
+
+    ~trace_span() {
+        if (begin_ns) {
+            traceRecord(name, begin_ns, traceNow(), request_id);
+        }
+    }
+};
+
+/**
+ * @struct weights_mapping
+ * @brief Read-only weights file kept alive by every network and executable network that may reference it.
+ */
+struct weights_mapping {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    std::vector<uint8_t> copy;
+
+    ~weights_mapping() {
+#ifdef __linux__
+        if (mapped) {
+            munmap(const_cast<uint8_t *>(data), size);
+        }
+#endif
+    }
+};
+
+/**
+ * @struct ie_weights
+ * @brief This struct represents weights shared by several networks.
+ */
+struct ie_weights {
+    std::shared_ptr<weights_mapping> mapping;
+};
+
+/**
+ * @struct capture_log
+ * @brief An open capture log shared by the capture handle and the infer requests attached to it.
+ */
+struct capture_log {
+    std::mutex mutex;
+    FILE *file = nullptr;
+    double sample_rate = 1.0;
+    uint64_t max_bytes = 0;
+    std::chrono::steady_clock::time_point origin;
+    uint64_t submits = 0;
+    uint64_t sampled = 0;
+    uint64_t recorded = 0;
+    uint64_t dropped = 0;
+    uint64_t bytes = 0;
+    bool failed = false;  // a write failed, the log ends with a partial record and nothing more is appended
+
+    ~capture_log() {
+        if (file) {
+            fclose(file);
+        }
+    }
+};
+
+/**
+ * @struct ie_capture
+ * @brief This struct represents a capture of infer request traffic.
+ */
+struct ie_capture {
+    std::shared_ptr<capture_log> log;
+};
+
+/**
+ * @struct cache_key
+ * @brief 128-bit hash of the inputs of an inference.
+ */
+struct cache_key {
+    uint64_t lo;
+    uint64_t hi;
+
+    bool operator==(const cache_key &other) const {
+        return lo == other.lo && hi == other.hi;
+    }
+};
+
+struct cache_key_hash {
+    size_t operator()(const cache_key &key) const {
+        return static_cast<size_t>(key.lo);
+    }
+};
+
+struct result_cache_state;
+
+/**
+ * @struct ie_result_cache
+ * @brief This struct represents a cache of inference outputs keyed by the content of the inputs.
+ */
+struct ie_result_cache {
+    std::shared_ptr<result_cache_state> state;
+};
+
+struct frame_gate_state;
+
+/**
+ * @struct ie_frame_gate
+ * @brief This struct represents a gate skipping inferences on frames close to the last inferred one.
+ */
+struct ie_frame_gate {
+    std::shared_ptr<frame_gate_state> state;
+};
+
 /**
  * @struct ie_core
  * @brief This struct represents Inference Engine Core entity.
  */
 struct ie_core {
     IE::Core object;
+    mem_tracker mem{MEM_CORE, SITE_CORE_CREATE, sizeof(ie_core)};
 };
 
 /**
@@ -36,6 +452,10 @@ struct ie_core {
  */
 struct ie_executable {
     IE::ExecutableNetwork object;
+    size_t dyn_batch_limit = 0;
+    std::shared_ptr<weights_mapping> weights;
+    std::shared_ptr<exec_memory> memory = std::make_shared<exec_memory>();
+    mem_tracker mem{MEM_EXECUTABLE, SITE_LOAD_NETWORK, sizeof(ie_executable)};
 };
 
 /**
@@ -44,6 +464,28 @@ struct ie_executable {
  */
 struct ie_infer_request {
     IE::InferRequest object;
+    size_t dyn_batch_limit = 0;
+    std::shared_ptr<exec_memory> exec_mem;
+    mem_tracker mem{MEM_REQUEST, SITE_CREATE_INFER_REQUEST, sizeof(ie_infer_request)};
+    uint64_t id = next_request_id.fetch_add(1, std::memory_order_relaxed) + 1;
+    std::shared_ptr<capture_log> capture;
+    std::vector<std::pair<std::string, IE::Blob::Ptr>> capture_inputs;
+    ie_complete_call_back_t *callback = nullptr;
+    std::shared_ptr<result_cache_state> result_cache;
+    bool served = false;         // the last submit was served by the frame gate or the result cache, without inference
+    IE::StatusCode last_status = IE::StatusCode::OK;  // of the last asynchronous submit, set before its callback runs
+    bool cache_pending = false;  // the last submit missed, its outputs are inserted when it completes
+    cache_key pending_key = {0, 0};
+    std::shared_ptr<frame_gate_state> frame_gate;
+    bool gate_pending = false;   // the last submit passed the gate, its outputs are kept when it completes
+    uint64_t gate_sequence = 0;  // the reference frame of the gate set by the last submit
+
+    ~ie_infer_request() {
+        if (exec_mem) {
+            exec_mem->num_requests.fetch_sub(1, std::memory_order_relaxed);
+            exec_mem->request_blob_bytes.fetch_sub(mem.data_bytes, std::memory_order_relaxed);
+        }
+    }
 };
 
 /**
@@ -52,6 +494,7 @@ struct ie_infer_request {
  */
 struct ie_blob {
     IE::Blob::Ptr object;
+    mem_tracker mem{MEM_BLOB, SITE_INFER_REQUEST_GET_BLOB, sizeof(ie_blob)};
 };
 
 /**
@@ -60,61 +503,153 @@ struct ie_blob {
  */
 struct ie_network {
     IE::CNNNetwork object;
+    std::shared_ptr<weights_mapping> weights;
+    mem_tracker mem{MEM_NETWORK, SITE_READ_NETWORK, sizeof(ie_network)};
+};
+
+/**
+ * @struct ie_config_handle
+ * @brief Configuration converted once to the maps taken by the Inference Engine.
+ */
+struct ie_config_handle {
+    std::map<std::string, std::string> string_map;
+    std::map<std::string, IE::Parameter> param_map;
 };
 
-std::map<IE::StatusCode, IEStatusCode> status_map = {{IE::StatusCode::GENERAL_ERROR, IEStatusCode::GENERAL_ERROR},
-                                                        {IE::StatusCode::INFER_NOT_STARTED, IEStatusCode::INFER_NOT_STARTED},
-                                                        {IE::StatusCode::NETWORK_NOT_LOADED,  IEStatusCode::NETWORK_NOT_LOADED},
-                                                        {IE::StatusCode::NETWORK_NOT_READ,  IEStatusCode::NETWORK_NOT_READ},
-                                                        {IE::StatusCode::NOT_ALLOCATED,  IEStatusCode::NOT_ALLOCATED},
-                                                        {IE::StatusCode::NOT_FOUND,   IEStatusCode::NOT_FOUND},
-                                                        {IE::StatusCode::NOT_IMPLEMENTED,  IEStatusCode::NOT_IMPLEMENTED},
-                                                        {IE::StatusCode::OK,   IEStatusCode::OK},
-                                                        {IE::StatusCode::OUT_OF_BOUNDS, IEStatusCode::OUT_OF_BOUNDS},
-                                                        {IE::StatusCode::PARAMETER_MISMATCH, IEStatusCode::PARAMETER_MISMATCH},
-                                                        {IE::StatusCode::REQUEST_BUSY, IEStatusCode::REQUEST_BUSY},
-                                                        {IE::StatusCode::RESULT_NOT_READY, IEStatusCode::RESULT_NOT_READY},
-                                                        {IE::StatusCode::UNEXPECTED, IEStatusCode::UNEXPECTED}};
-
-std::map<IE::Precision, precision_e> precision_map = {{IE::Precision::UNSPECIFIED, precision_e::UNSPECIFIED},
-                                                        {IE::Precision::MIXED, precision_e::MIXED},
-                                                        {IE::Precision::FP32, precision_e::FP32},
-                                                        {IE::Precision::FP16, precision_e::FP16},
-                                                        {IE::Precision::Q78, precision_e::Q78},
-                                                        {IE::Precision::I16, precision_e::I16},
-                                                        {IE::Precision::U8, precision_e::U8},
-                                                        {IE::Precision::I8, precision_e::I8},
-                                                        {IE::Precision::U16, precision_e::U16},
-                                                        {IE::Precision::I32, precision_e::I32},
-                                                        {IE::Precision::I64, precision_e::I64},
-                                                        {IE::Precision::BIN, precision_e::BIN},
-                                                        {IE::Precision::CUSTOM, precision_e::CUSTOM}};
-
-std::map<IE::Layout, layout_e> layout_map = {{IE::Layout::ANY, layout_e::ANY},
-                                                {IE::Layout::NCHW, layout_e::NCHW},
-                                                {IE::Layout::NHWC, layout_e::NHWC},
-                                                {IE::Layout::NCDHW, layout_e::NCDHW},
-                                                {IE::Layout::NDHWC, layout_e::NDHWC},
-                                                {IE::Layout::OIHW, layout_e::OIHW},
-                                                {IE::Layout::SCALAR, layout_e::SCALAR},
-                                                {IE::Layout::C, layout_e::C},
-                                                {IE::Layout::CHW, layout_e::CHW},
-                                                {IE::Layout::HW, layout_e::HW},
-                                                {IE::Layout::NC, layout_e::NC},
-                                                {IE::Layout::CN, layout_e::CN},
-                                                {IE::Layout::BLOCKED, layout_e::BLOCKED}};
-
-std::map<IE::ResizeAlgorithm, resize_alg_e> resize_alg_map = {{IE::ResizeAlgorithm::NO_RESIZE, resize_alg_e::NO_RESIZE},
-                                                                {IE::ResizeAlgorithm::RESIZE_AREA, resize_alg_e::RESIZE_AREA},
-                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR}};
-
-std::map<IE::ColorFormat, colorformat_e> colorformat_map = {{IE::ColorFormat::RAW, colorformat_e::RAW},
-                                                            {IE::ColorFormat::RGB, colorformat_e::RGB},
-                                                            {IE::ColorFormat::BGR, colorformat_e::BGR},
-                                                            {IE::ColorFormat::BGRX, colorformat_e::BGRX},
-                                                            {IE::ColorFormat::RGBX, colorformat_e::RGBX},
-                                                            {IE::ColorFormat::I420, colorformat_e::I420},
-                                                            {IE::ColorFormat::NV12, colorformat_e::NV12}};
+/**
+ *@brief convert between the Inference Engine and the C API enums. The conversions are read-only switches
+ * so that concurrent calls from every API entry point share no mutable state.
+ */
+IEStatusCode status2IEStatus(IE::StatusCode status) {
+    switch (status) {
+    case IE::StatusCode::OK: return IEStatusCode::OK;
+    case IE::StatusCode::GENERAL_ERROR: return IEStatusCode::GENERAL_ERROR;
+    case IE::StatusCode::NOT_IMPLEMENTED: return IEStatusCode::NOT_IMPLEMENTED;
+    case IE::StatusCode::NETWORK_NOT_LOADED: return IEStatusCode::NETWORK_NOT_LOADED;
+    case IE::StatusCode::PARAMETER_MISMATCH: return IEStatusCode::PARAMETER_MISMATCH;
+    case IE::StatusCode::NOT_FOUND: return IEStatusCode::NOT_FOUND;
+    case IE::StatusCode::OUT_OF_BOUNDS: return IEStatusCode::OUT_OF_BOUNDS;
+    case IE::StatusCode::UNEXPECTED: return IEStatusCode::UNEXPECTED;
+    case IE::StatusCode::REQUEST_BUSY: return IEStatusCode::REQUEST_BUSY;
+    case IE::StatusCode::RESULT_NOT_READY: return IEStatusCode::RESULT_NOT_READY;
+    case IE::StatusCode::NOT_ALLOCATED: return IEStatusCode::NOT_ALLOCATED;
+    case IE::StatusCode::INFER_NOT_STARTED: return IEStatusCode::INFER_NOT_STARTED;
+    case IE::StatusCode::NETWORK_NOT_READ: return IEStatusCode::NETWORK_NOT_READ;
+    default: return IEStatusCode::UNEXPECTED;
+    }
+}
+
+precision_e precision2IEprecision(const IE::Precision &precision) {
+    switch (precision) {
+    case IE::Precision::MIXED: return precision_e::MIXED;
+    case IE::Precision::FP32: return precision_e::FP32;
+    case IE::Precision::FP16: return precision_e::FP16;
+    case IE::Precision::Q78: return precision_e::Q78;
+    case IE::Precision::I16: return precision_e::I16;
+    case IE::Precision::U8: return precision_e::U8;
+    case IE::Precision::I8: return precision_e::I8;
+    case IE::Precision::U16: return precision_e::U16;
+    case IE::Precision::I32: return precision_e::I32;
+    case IE::Precision::I64: return precision_e::I64;
+    case IE::Precision::BIN: return precision_e::BIN;
+    case IE::Precision::CUSTOM: return precision_e::CUSTOM;
+    default: return precision_e::UNSPECIFIED;
+    }
+}
+
+IE::Precision IEprecision2precision(precision_e precision) {
+    switch (precision) {
+    case precision_e::MIXED: return IE::Precision::MIXED;
+    case precision_e::FP32: return IE::Precision::FP32;
+    case precision_e::FP16: return IE::Precision::FP16;
+    case precision_e::Q78: return IE::Precision::Q78;
+    case precision_e::I16: return IE::Precision::I16;
+    case precision_e::U8: return IE::Precision::U8;
+    case precision_e::I8: return IE::Precision::I8;
+    case precision_e::U16: return IE::Precision::U16;
+    case precision_e::I32: return IE::Precision::I32;
+    case precision_e::I64: return IE::Precision::I64;
+    case precision_e::BIN: return IE::Precision::BIN;
+    case precision_e::CUSTOM: return IE::Precision::CUSTOM;
+    default: return IE::Precision::UNSPECIFIED;
+    }
+}
+
+layout_e layout2IElayout(IE::Layout layout) {
+    switch (layout) {
+    case IE::Layout::NCHW: return layout_e::NCHW;
+    case IE::Layout::NHWC: return layout_e::NHWC;
+    case IE::Layout::NCDHW: return layout_e::NCDHW;
+    case IE::Layout::NDHWC: return layout_e::NDHWC;
+    case IE::Layout::OIHW: return layout_e::OIHW;
+    case IE::Layout::SCALAR: return layout_e::SCALAR;
+    case IE::Layout::C: return layout_e::C;
+    case IE::Layout::CHW: return layout_e::CHW;
+    case IE::Layout::HW: return layout_e::HW;
+    case IE::Layout::NC: return layout_e::NC;
+    case IE::Layout::CN: return layout_e::CN;
+    case IE::Layout::BLOCKED: return layout_e::BLOCKED;
+    default: return layout_e::ANY;
+    }
+}
+
+IE::Layout IElayout2layout(layout_e layout) {
+    switch (layout) {
+    case layout_e::ANY: return IE::Layout::ANY;
+    case layout_e::NHWC: return IE::Layout::NHWC;
+    case layout_e::NCDHW: return IE::Layout::NCDHW;
+    case layout_e::NDHWC: return IE::Layout::NDHWC;
+    case layout_e::OIHW: return IE::Layout::OIHW;
+    case layout_e::SCALAR: return IE::Layout::SCALAR;
+    case layout_e::C: return IE::Layout::C;
+    case layout_e::CHW: return IE::Layout::CHW;
+    case layout_e::HW: return IE::Layout::HW;
+    case layout_e::NC: return IE::Layout::NC;
+    case layout_e::CN: return IE::Layout::CN;
+    case layout_e::BLOCKED: return IE::Layout::BLOCKED;
+    default: return IE::Layout::NCHW;
+    }
+}
+
+resize_alg_e resize2IEresize(IE::ResizeAlgorithm resize) {
+    switch (resize) {
+    case IE::ResizeAlgorithm::RESIZE_BILINEAR: return resize_alg_e::RESIZE_BILINEAR;
+    case IE::ResizeAlgorithm::RESIZE_AREA: return resize_alg_e::RESIZE_AREA;
+    default: return resize_alg_e::NO_RESIZE;
+    }
+}
+
+IE::ResizeAlgorithm IEresize2resize(resize_alg_e resize) {
+    switch (resize) {
+    case resize_alg_e::RESIZE_BILINEAR: return IE::ResizeAlgorithm::RESIZE_BILINEAR;
+    case resize_alg_e::RESIZE_AREA: return IE::ResizeAlgorithm::RESIZE_AREA;
+    default: return IE::ResizeAlgorithm::NO_RESIZE;
+    }
+}
+
+colorformat_e colorformat2IEcolorformat(IE::ColorFormat color) {
+    switch (color) {
+    case IE::ColorFormat::RGB: return colorformat_e::RGB;
+    case IE::ColorFormat::BGR: return colorformat_e::BGR;
+    case IE::ColorFormat::RGBX: return colorformat_e::RGBX;
+    case IE::ColorFormat::BGRX: return colorformat_e::BGRX;
+    case IE::ColorFormat::NV12: return colorformat_e::NV12;
+    case IE::ColorFormat::I420: return colorformat_e::I420;
+    default: return colorformat_e::RAW;
+    }
+}
+
+IE::ColorFormat IEcolorformat2colorformat(colorformat_e color) {
+    switch (color) {
+    case colorformat_e::RAW: return IE::ColorFormat::RAW;
+    case colorformat_e::BGR: return IE::ColorFormat::BGR;
+    case colorformat_e::RGBX: return IE::ColorFormat::RGBX;
+    case colorformat_e::BGRX: return IE::ColorFormat::BGRX;
+    case colorformat_e::NV12: return IE::ColorFormat::NV12;
+    case colorformat_e::I420: return IE::ColorFormat::I420;
+    default: return IE::ColorFormat::RGB;
+    }
+}
 
 /**
  *@brief convert the config type data to map type data.
@@ -134,7 +669,7 @@ std::map<std::string, IE::Parameter> config2ParamMap(const ie_config_t *config)
     std::map<std::string, IE::Parameter> param_map;
     const ie_config_t *tmp = config;
 
-    while (tmp) {
+    while (tmp && tmp->name && tmp->value) {
         IE::Parameter param = IE::Parameter(std::string(tmp->value));
         param_map[tmp->name] = param;
         tmp = tmp->next;
@@ -142,6 +677,108 @@ std::map<std::string, IE::Parameter> config2ParamMap(const ie_config_t *config)
     return param_map;
 }
 
+/**
+ *@brief convert the map type data to config type data. An empty map gives one terminating node.
+ */
+ie_config_t *map2Config(const std::map<std::string, std::string> &m) {
+    std::unique_ptr<ie_config_t> head(new ie_config_t{NULL, NULL, NULL});
+    ie_config_t *tail = nullptr;
+
+    for (auto it = m.rbegin(); it != m.rend(); ++it) {
+        std::unique_ptr<ie_config_t> node(new ie_config_t{NULL, NULL, tail});
+        std::unique_ptr<char[]> name(new char[it->first.length() + 1]);
+        std::unique_ptr<char[]> value(new char[it->second.length() + 1]);
+        memcpy(name.get(), it->first.c_str(), it->first.length() + 1);
+        memcpy(value.get(), it->second.c_str(), it->second.length() + 1);
+        node->name = name.release();
+        node->value = value.release();
+        tail = node.release();
+    }
+
+    if (tail) {
+        return tail;
+    }
+    return head.release();
+}
+
+size_t residentBytes() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    size_t total = 0, resident = 0;
+    if (statm >> total >> resident) {
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+/**
+ *@brief records the resident set growth of a load and ties the executable network to the shared weights of its network.
+ */
+void trackLoad(const ie_network_t *network, ie_executable_network_t *exe_network, size_t rss_before) {
+    size_t rss_after = residentBytes();
+    exe_network->mem.setData(MEM_DATA_LOAD, rss_after > rss_before ? rss_after - rss_before : 0);
+    if (network) {
+        exe_network->weights = network->weights;
+    }
+}
+
+const char *memSiteName(mem_site site) {
+    switch (site) {
+    case SITE_CORE_CREATE: return "ie_core_create";
+    case SITE_READ_NETWORK: return "ie_core_read_network";
+    case SITE_LOAD_NETWORK: return "ie_core_load_network";
+    case SITE_IMPORT_NETWORK: return "ie_core_import_network";
+    case SITE_CREATE_INFER_REQUEST: return "ie_exec_network_create_infer_request";
+    case SITE_INFER_REQUEST_GET_BLOB: return "ie_infer_request_get_blob";
+    case SITE_BLOB_MAKE_MEMORY: return "ie_blob_make_memory";
+    case SITE_BLOB_MAKE_PREALLOCATED: return "ie_blob_make_memory_from_preallocated";
+    case SITE_BLOB_MAKE_ROI: return "ie_blob_make_memory_with_roi";
+    case SITE_BLOB_MAKE_NV12: return "ie_blob_make_memory_nv12";
+    case SITE_BLOB_MAKE_I420: return "ie_blob_make_memory_i420";
+    default: return "unknown";
+    }
+}
+
+/**
+ *@brief fill the input blobs of the request with synthetic data of the input precision.
+ * Integer inputs wider than 8 bit are usually indices and are filled with zeros to stay in range.
+ */
+void fillSyntheticInputs(const IE::ExecutableNetwork &exe_net, IE::InferRequest &request, std::mt19937 &gen) {
+    for (const auto &input : exe_net.GetInputsInfo()) {
+        IE::Blob::Ptr blob = request.GetBlob(input.first);
+        IE::Precision prec = blob->getTensorDesc().getPrecision();
+        void *ptr = blob->buffer();
+        if (ptr == nullptr) {
+            continue;
+        }
+
+        if (prec == IE::Precision::FP32) {
+            std::uniform_real_distribution<float> dist(0.f, 1.f);
+            float *data = static_cast<float *>(ptr);
+            for (size_t i = 0; i < blob->size(); ++i) {
+                data[i] = dist(gen);
+            }
+        } else if (prec == IE::Precision::FP16) {
+            // half precision values in [0.5, 1)
+            std::uniform_int_distribution<uint16_t> dist(0x3800, 0x3bff);
+            uint16_t *data = static_cast<uint16_t *>(ptr);
+            for (size_t i = 0; i < blob->size(); ++i) {
+                data[i] = dist(gen);
+            }
+        } else if (prec == IE::Precision::I32 || prec == IE::Precision::I64 || prec == IE::Precision::I16 ||
+                   prec == IE::Precision::U16) {
+            memset(ptr, 0, blob->byteSize());
+        } else {
+            std::uniform_int_distribution<int> dist(0, 255);
+            uint8_t *data = static_cast<uint8_t *>(ptr);
+            for (size_t i = 0; i < blob->byteSize(); ++i) {
+                data[i] = static_cast<uint8_t>(dist(gen));
+            }
+        }
+    }
+}
+
 /**
  *@brief convert the paramter.
  */
@@ -181,6 +818,87 @@ void parameter2IEparam(const IE::Parameter param, ie_param_t *ie_param) {
     }
 }
 
+/**
+ *@brief convert the paramter to a typed one, string lists are packed in one allocation
+ * with the pointers first and the characters after them.
+ */
+IEStatusCode parameter2IEparamV2(const IE::Parameter &param, ie_param_v2_t *ie_param) {
+    ie_param->type = param_type_e::PARAM_EMPTY;
+    if (param.empty()) {
+        return IEStatusCode::OK;
+    }
+
+    if (param.is<std::string>()) {
+        const std::string &val = param.as<std::string>();
+        std::unique_ptr<char[]> str(new char[val.length() + 1]);
+        memcpy(str.get(), val.c_str(), val.length() + 1);
+        ie_param->string = str.release();
+        ie_param->type = param_type_e::PARAM_STRING;
+    } else if (param.is<std::vector<std::string>>()) {
+        const std::vector<std::string> &val = param.as<std::vector<std::string>>();
+        size_t bytes = val.size() * sizeof(char *);
+        for (const auto &item : val) {
+            bytes += item.length() + 1;
+        }
+
+        std::unique_ptr<char[]> block(new char[std::max<size_t>(bytes, 1)]);
+        char **items = reinterpret_cast<char **>(block.get());
+        char *chars = block.get() + val.size() * sizeof(char *);
+        for (size_t i = 0; i < val.size(); ++i) {
+            items[i] = chars;
+            memcpy(chars, val[i].c_str(), val[i].length() + 1);
+            chars += val[i].length() + 1;
+        }
+        ie_param->string_list.items = reinterpret_cast<char **>(block.release());
+        ie_param->string_list.num = val.size();
+        ie_param->type = param_type_e::PARAM_STRING_LIST;
+    } else if (param.is<unsigned int>()) {
+        ie_param->uint_value = param.as<unsigned int>();
+        ie_param->type = param_type_e::PARAM_UINT;
+    } else if (param.is<unsigned long>()) {
+        ie_param->uint_value = param.as<unsigned long>();
+        ie_param->type = param_type_e::PARAM_UINT;
+    } else if (param.is<unsigned long long>()) {
+        ie_param->uint_value = param.as<unsigned long long>();
+        ie_param->type = param_type_e::PARAM_UINT;
+    } else if (param.is<int>()) {
+        ie_param->int_value = param.as<int>();
+        ie_param->type = param_type_e::PARAM_INT;
+    } else if (param.is<long>()) {
+        ie_param->int_value = param.as<long>();
+        ie_param->type = param_type_e::PARAM_INT;
+    } else if (param.is<long long>()) {
+        ie_param->int_value = param.as<long long>();
+        ie_param->type = param_type_e::PARAM_INT;
+    } else if (param.is<float>()) {
+        ie_param->float_value = param.as<float>();
+        ie_param->type = param_type_e::PARAM_FLOAT;
+    } else if (param.is<double>()) {
+        ie_param->float_value = param.as<double>();
+        ie_param->type = param_type_e::PARAM_FLOAT;
+    } else if (param.is<bool>()) {
+        ie_param->bool_value = param.as<bool>() ? 1 : 0;
+        ie_param->type = param_type_e::PARAM_BOOL;
+    } else if (param.is<std::tuple<unsigned int, unsigned int>>()) {
+        auto val = param.as<std::tuple<unsigned int, unsigned int>>();
+        ie_param->tuple.values[0] = std::get<0>(val);
+        ie_param->tuple.values[1] = std::get<1>(val);
+        ie_param->tuple.num = 2;
+        ie_param->type = param_type_e::PARAM_UINT_TUPLE;
+    } else if (param.is<std::tuple<unsigned int, unsigned int, unsigned int>>()) {
+        auto val = param.as<std::tuple<unsigned int, unsigned int, unsigned int>>();
+        ie_param->tuple.values[0] = std::get<0>(val);
+        ie_param->tuple.values[1] = std::get<1>(val);
+        ie_param->tuple.values[2] = std::get<2>(val);
+        ie_param->tuple.num = 3;
+        ie_param->type = param_type_e::PARAM_UINT_TUPLE;
+    } else {
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
 ie_version_t ie_c_api_version(void) {
     auto version = IE::GetInferenceEngineVersion();
     std::string version_str = std::to_string(version->apiVersion.major) + ".";
@@ -209,6 +927,18 @@ void ie_param_free(ie_param_t *param) {
     }
 }
 
+void ie_param_v2_free(ie_param_v2_t *param) {
+    if (param) {
+        if (param->type == param_type_e::PARAM_STRING) {
+            delete[] param->string;
+        } else if (param->type == param_type_e::PARAM_STRING_LIST) {
+            delete[] reinterpret_cast<char *>(param->string_list.items);
+        }
+        param->type = param_type_e::PARAM_EMPTY;
+        param->string = NULL;
+    }
+}
+
 IEStatusCode ie_core_create(const char *xml_config_file, ie_core_t **core) {
     if (xml_config_file == nullptr || core == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -220,7 +950,7 @@ IEStatusCode ie_core_create(const char *xml_config_file, ie_core_t **core) {
         tmp->object = IE::Core(xml_config_file);
         *core = tmp.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -266,7 +996,7 @@ IEStatusCode ie_core_get_versions(const ie_core_t *core, const char *device_name
         }
         versions->versions = vers_ptrs.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -293,6 +1023,7 @@ IEStatusCode ie_core_read_network(ie_core_t *core, const char *xml, const char *
     IEStatusCode status = IEStatusCode::OK;
 
     try {
+        trace_span span("ie_core_read_network");
         std::unique_ptr<ie_network_t> network_result(new ie_network_t);
         std::string bin = "";
         if (weights_file) {
@@ -301,7 +1032,7 @@ IEStatusCode ie_core_read_network(ie_core_t *core, const char *xml, const char *
         network_result->object = core->object.ReadNetwork(xml, bin);
         *network = network_result.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -309,128 +1040,159 @@ IEStatusCode ie_core_read_network(ie_core_t *core, const char *xml, const char *
     return status;
 }
 
-IEStatusCode ie_core_load_network(ie_core_t *core, const ie_network_t *network, const char *device_name, \
-        const ie_config_t *config, ie_executable_network_t **exe_network) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (core == nullptr || network == nullptr || device_name == nullptr || config == nullptr || exe_network == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_weights_create(const char *weights_file, ie_weights_t **weights) {
+    if (weights_file == nullptr || weights == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        std::map<std::string, std::string> conf_map;
-        conf_map = config2Map(config);
-        std::unique_ptr<ie_executable_network_t> exe_net(new ie_executable_network_t);
+        std::shared_ptr<weights_mapping> mapping = std::make_shared<weights_mapping>();
+#ifdef __linux__
+        int fd = open(weights_file, O_RDONLY);
+        if (fd < 0) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            // pages of a read-only file mapping are shared through the page cache, even between processes
+            void *addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                mapping->data = static_cast<const uint8_t *>(addr);
+                mapping->size = static_cast<size_t>(st.st_size);
+                mapping->mapped = true;
+            }
+        }
+        close(fd);
+#endif
+        if (!mapping->mapped) {
+            std::ifstream file(weights_file, std::ios::binary);
+            if (!file) {
+                return IEStatusCode::NOT_FOUND;
+            }
+            mapping->copy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            mapping->data = mapping->copy.data();
+            mapping->size = mapping->copy.size();
+        }
 
-        // create plugin in the registery and then create ExecutableNetwork.
-        exe_net->object = core->object.LoadNetwork(network->object, device_name, conf_map);
-        *exe_network = exe_net.release();
-    } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        std::unique_ptr<ie_weights_t> result(new ie_weights_t);
+        result->mapping = mapping;
+        *weights = result.release();
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_core_set_config(ie_core_t *core, const ie_config_t *ie_core_config, const char *device_name) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (core == nullptr || ie_core_config == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+void ie_weights_free(ie_weights_t **weights) {
+    if (weights) {
+        delete *weights;
+        *weights = NULL;
     }
+}
 
-    const std::map<std::string, std::string> conf_map = config2Map(ie_core_config);
-    std::string deviceName;
-    if (device_name != nullptr) {
-        deviceName = std::string(device_name);
+IEStatusCode ie_weights_get_memory(const ie_weights_t *weights, ie_weights_memory_t *memory) {
+    if (weights == nullptr || memory == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
-    try {
-        core->object.SetConfig(conf_map, deviceName);
-    } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
-    } catch (...) {
-        return IEStatusCode::UNEXPECTED;
+    const weights_mapping &mapping = *weights->mapping;
+    memory->mapped_bytes = mapping.size;
+    memory->resident_bytes = mapping.size;
+#ifdef __linux__
+    if (mapping.mapped) {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        std::vector<unsigned char> pages((mapping.size + page - 1) / page);
+        if (mincore(const_cast<uint8_t *>(mapping.data), mapping.size, pages.data()) == 0) {
+            size_t resident = 0;
+            for (unsigned char p : pages) {
+                resident += p & 1;
+            }
+            memory->resident_bytes = std::min(resident * page, mapping.size);
+        }
     }
+#endif
+    // the handle holds one reference, the rest are networks and executable networks
+    memory->num_users = static_cast<size_t>(weights->mapping.use_count() - 1);
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_core_register_plugin(ie_core_t *core, const char *plugin_name, const char *device_name ) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (core == nullptr || plugin_name == nullptr || device_name == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_core_read_network_with_weights(ie_core_t *core, const char *xml, const ie_weights_t *weights, ie_network_t **network) {
+    if (core == nullptr || xml == nullptr || weights == nullptr || network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        core->object.RegisterPlugin(plugin_name, device_name);
-    } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
-    } catch (...) {
-        return IEStatusCode::UNEXPECTED;
-    }
-
-    return status;
-}
-
-IEStatusCode ie_core_register_plugins(ie_core_t *core, const char *xml_config_file) {
-    IEStatusCode status = IEStatusCode::OK;
+        trace_span span("ie_core_read_network_with_weights");
+        std::ifstream file(xml);
+        if (!file) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        std::string model((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-    if (core == nullptr || xml_config_file == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
-    }
+        const weights_mapping &mapping = *weights->mapping;
+        IE::TensorDesc desc(IE::Precision::U8, {mapping.size}, IE::Layout::C);
+        IE::Blob::CPtr blob = IE::make_shared_blob<uint8_t>(desc, const_cast<uint8_t *>(mapping.data), mapping.size);
 
-    try {
-        core->object.RegisterPlugins(xml_config_file);
+        std::unique_ptr<ie_network_t> network_result(new ie_network_t);
+        network_result->object = core->object.ReadNetwork(model, blob);
+        network_result->weights = weights->mapping;
+        *network = network_result.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_core_unregister_plugin(ie_core_t *core, const char *device_name) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (core == nullptr || device_name == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_core_read_network_from_memory(ie_core_t *core, const uint8_t *xml_content, size_t xml_content_size, \
+        const ie_blob_t *weight_blob, ie_network_t **network) {
+    if (core == nullptr || xml_content == nullptr || network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        core->object.UnregisterPlugin(device_name);
+        trace_span span("ie_core_read_network_from_memory");
+        std::string model(reinterpret_cast<const char *>(xml_content), xml_content_size);
+        IE::Blob::CPtr weights = weight_blob ? weight_blob->object : IE::Blob::CPtr();
+
+        std::unique_ptr<ie_network_t> network_result(new ie_network_t);
+        network_result->object = core->object.ReadNetwork(model, weights);
+        *network = network_result.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_core_add_extension(ie_core_t *core, const char *extension_path, const char *device_name) {
+IEStatusCode ie_core_load_network(ie_core_t *core, const ie_network_t *network, const char *device_name, \
+        const ie_config_t *config, ie_executable_network_t **exe_network) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (core == nullptr || extension_path == nullptr || device_name == nullptr) {
+    if (core == nullptr || network == nullptr || device_name == nullptr || config == nullptr || exe_network == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        auto extension_ptr = InferenceEngine::make_so_pointer<InferenceEngine::IExtension>(extension_path);
-        auto extension = std::dynamic_pointer_cast<InferenceEngine::IExtension>(extension_ptr);
-        core->object.AddExtension(extension, device_name);
+        trace_span span("ie_core_load_network");
+        std::map<std::string, std::string> conf_map;
+        conf_map = config2Map(config);
+        std::unique_ptr<ie_executable_network_t> exe_net(new ie_executable_network_t);
+
+        // create plugin in the registery and then create ExecutableNetwork.
+        size_t rss_before = residentBytes();
+        exe_net->object = core->object.LoadNetwork(network->object, device_name, conf_map);
+        trackLoad(network, exe_net.get(), rss_before);
+        *exe_network = exe_net.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -438,88 +1200,151 @@ IEStatusCode ie_core_add_extension(ie_core_t *core, const char *extension_path,
     return status;
 }
 
-IEStatusCode ie_core_get_metric(const ie_core_t *core, const char *device_name, const char *metric_name, ie_param_t *param_result) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (core == nullptr || device_name == nullptr || metric_name == nullptr || param_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_core_load_network_dyn_batch(ie_core_t *core, ie_network_t *network, const char *device_name, \
+        const ie_config_t *config, const size_t max_batch, ie_executable_network_t **exe_network) {
+    if (core == nullptr || network == nullptr || device_name == nullptr || config == nullptr || exe_network == nullptr || max_batch == 0) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::Parameter param = core->object.GetMetric(device_name, metric_name);
-        parameter2IEparam(param, param_result);
+        trace_span span("ie_core_load_network_dyn_batch");
+        // the plugin allocates for the batch of the network, which is the upper bound of SetBatch()
+        network->object.setBatchSize(max_batch);
+
+        std::map<std::string, std::string> conf_map = config2Map(config);
+        conf_map[CONFIG_KEY(DYN_BATCH_ENABLED)] = CONFIG_VALUE(YES);
+        conf_map[CONFIG_KEY(DYN_BATCH_LIMIT)] = std::to_string(max_batch);
+
+        std::unique_ptr<ie_executable_network_t> exe_net(new ie_executable_network_t);
+        size_t rss_before = residentBytes();
+        exe_net->object = core->object.LoadNetwork(network->object, device_name, conf_map);
+        trackLoad(network, exe_net.get(), rss_before);
+        exe_net->dyn_batch_limit = max_batch;
+        *exe_network = exe_net.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_core_get_config(const ie_core_t *core, const char *device_name, const char *config_name, ie_param_t *param_result) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (core == nullptr || device_name == nullptr || config_name == nullptr || param_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_core_load_network_from_file(ie_core_t *core, const char *xml, \
+        const char *weights_file, const char *device_name, const ie_config_t *config, const ie_preprocess_spec_t *preprocess_spec, \
+        ie_executable_network_t **exe_network) {
+    if (core == nullptr || xml == nullptr || device_name == nullptr || config == nullptr || exe_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::Parameter param = core->object.GetConfig(device_name, config_name);
+        trace_span span("ie_core_load_network_from_file");
+        std::unique_ptr<ie_executable_network_t> exe_net(new ie_executable_network_t);
+        size_t rss_before = residentBytes();
+        {
+            // the graph and its weights are released at the end of this scope, before the function returns
+            IE::CNNNetwork network = core->object.ReadNetwork(xml, weights_file ? weights_file : "");
+
+            if (preprocess_spec) {
+                IE::InputsDataMap inputs = network.getInputsInfo();
+                for (size_t i = 0; i < preprocess_spec->num_inputs; ++i) {
+                    const ie_port_spec_t &spec = preprocess_spec->inputs[i];
+                    if (spec.name && inputs.find(spec.name) == inputs.end()) {
+                        return IEStatusCode::NOT_FOUND;
+                    }
+                    for (auto &input : inputs) {
+                        if (spec.name && input.first != spec.name) {
+                            continue;
+                        }
+                        if (spec.precision != precision_e::UNSPECIFIED && spec.precision != precision_e::MIXED) {
+                            input.second->setPrecision(IEprecision2precision(spec.precision));
+                        }
+                        if (spec.layout != layout_e::ANY) {
+                            input.second->setLayout(IElayout2layout(spec.layout));
+                        }
+                        if (spec.resize_alg != resize_alg_e::NO_RESIZE) {
+                            input.second->getPreProcess().setResizeAlgorithm(IEresize2resize(spec.resize_alg));
+                        }
+                        if (spec.color_format != colorformat_e::RAW) {
+                            input.second->getPreProcess().setColorFormat(IEcolorformat2colorformat(spec.color_format));
+                        }
+                    }
+                }
 
-        // convert the parameter to ie_param_t
-        parameter2IEparam(param, param_result);
+                IE::OutputsDataMap outputs = network.getOutputsInfo();
+                for (size_t i = 0; i < preprocess_spec->num_outputs; ++i) {
+                    const ie_port_spec_t &spec = preprocess_spec->outputs[i];
+                    if (spec.name && outputs.find(spec.name) == outputs.end()) {
+                        return IEStatusCode::NOT_FOUND;
+                    }
+                    for (auto &output : outputs) {
+                        if (spec.name && output.first != spec.name) {
+                            continue;
+                        }
+                        if (spec.precision != precision_e::UNSPECIFIED && spec.precision != precision_e::MIXED) {
+                            output.second->setPrecision(IEprecision2precision(spec.precision));
+                        }
+                        if (spec.layout != layout_e::ANY) {
+                            output.second->setLayout(IElayout2layout(spec.layout));
+                        }
+                    }
+                }
+            }
+
+            exe_net->object = core->object.LoadNetwork(network, device_name, config2Map(config));
+        }
+        trackLoad(nullptr, exe_net.get(), rss_before);
+        *exe_network = exe_net.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
-}
-
-void ie_exec_network_free(ie_executable_network_t **ie_exec_network) {
-    if (ie_exec_network) {
-        delete *ie_exec_network;
-        *ie_exec_network = NULL;
-    }
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_exec_network_create_infer_request(ie_executable_network_t *ie_exec_network, ie_infer_request_t **request) {
-    IEStatusCode status = IEStatusCode::OK;
-    if (ie_exec_network == nullptr || request == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
+IEStatusCode ie_core_import_network(ie_core_t *core, const char *file_name, const char *device_name, \
+        const ie_config_t *config, ie_executable_network_t **exe_network) {
+    if (core == nullptr || file_name == nullptr || device_name == nullptr || config == nullptr || exe_network == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        std::unique_ptr<ie_infer_request_t> req(new ie_infer_request_t);
-        req->object = ie_exec_network->object.CreateInferRequest();
-        *request = req.release();
+        trace_span span("ie_core_import_network");
+        std::unique_ptr<ie_executable_network_t> exe_net(new ie_executable_network_t);
+        exe_net->mem.setSite(SITE_IMPORT_NETWORK);
+        size_t rss_before = residentBytes();
+        exe_net->object = core->object.ImportNetwork(file_name, device_name, config2Map(config));
+        trackLoad(nullptr, exe_net.get(), rss_before);
+        *exe_network = exe_net.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_exec_network_get_metric(const ie_executable_network_t *ie_exec_network, const char *metric_name, ie_param_t *param_result) {
+IEStatusCode ie_core_set_config(ie_core_t *core, const ie_config_t *ie_core_config, const char *device_name) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (ie_exec_network == nullptr || metric_name == nullptr || param_result == nullptr) {
+    if (core == nullptr || ie_core_config == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
+    const std::map<std::string, std::string> conf_map = config2Map(ie_core_config);
+    std::string deviceName;
+    if (device_name != nullptr) {
+        deviceName = std::string(device_name);
+    }
+
     try {
-        InferenceEngine::Parameter parameter = ie_exec_network->object.GetMetric(metric_name);
-        parameter2IEparam(parameter, param_result);
+        core->object.SetConfig(conf_map, deviceName);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -527,65 +1352,78 @@ IEStatusCode ie_exec_network_get_metric(const ie_executable_network_t *ie_exec_n
     return status;
 }
 
-IEStatusCode ie_exec_network_set_config(ie_executable_network_t *ie_exec_network, const ie_config_t *param_config) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (ie_exec_network == nullptr || param_config == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_config_handle_create(const ie_core_t *core, const char *device_name, const ie_config_pair_t *pairs, size_t num, \
+        ie_config_handle_t **handle) {
+    if (core == nullptr || (pairs == nullptr && num > 0) || handle == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        const std::map<std::string, IE::Parameter> conf_map = config2ParamMap(param_config);
-        ie_exec_network->object.SetConfig(conf_map);
+        std::set<std::string> supported;
+        if (device_name != nullptr) {
+            auto keys = core->object.GetMetric(device_name, METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
+            supported.insert(keys.begin(), keys.end());
+        }
+
+        std::unique_ptr<ie_config_handle_t> conf(new ie_config_handle_t);
+        for (size_t i = 0; i < num; ++i) {
+            if (pairs[i].name == nullptr || pairs[i].value == nullptr) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            if (device_name != nullptr && supported.find(pairs[i].name) == supported.end()) {
+                return IEStatusCode::NOT_FOUND;
+            }
+            conf->string_map[pairs[i].name] = pairs[i].value;
+            conf->param_map[pairs[i].name] = IE::Parameter(std::string(pairs[i].value));
+        }
+        *handle = conf.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_exec_network_get_config(const ie_executable_network_t *ie_exec_network, const char *metric_config, ie_param_t *param_result) {
-    IEStatusCode status = IEStatusCode::OK;
+void ie_config_handle_free(ie_config_handle_t **handle) {
+    if (handle) {
+        delete *handle;
+        *handle = NULL;
+    }
+}
 
-    if (ie_exec_network == nullptr || metric_config == nullptr || param_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_core_load_network_with_handle(ie_core_t *core, const ie_network_t *network, const char *device_name, \
+        const ie_config_handle_t *handle, ie_executable_network_t **exe_network) {
+    if (core == nullptr || network == nullptr || device_name == nullptr || handle == nullptr || exe_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        InferenceEngine::Parameter parameter = ie_exec_network->object.GetConfig(metric_config);
-        parameter2IEparam(parameter, param_result);
+        trace_span span("ie_core_load_network_with_handle");
+        std::unique_ptr<ie_executable_network_t> exe_net(new ie_executable_network_t);
+        size_t rss_before = residentBytes();
+        exe_net->object = core->object.LoadNetwork(network->object, device_name, handle->string_map);
+        trackLoad(network, exe_net.get(), rss_before);
+        *exe_network = exe_net.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
-}
-
-void ie_network_free(ie_network_t **network) {
-    if (network) {
-        delete *network;
-        *network = NULL;
-    }
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_get_name(const ie_network_t *network, char **name) {
-    if (network == nullptr || name == nullptr) {
+IEStatusCode ie_core_set_config_with_handle(ie_core_t *core, const ie_config_handle_t *handle, const char *device_name) {
+    if (core == nullptr || handle == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        std::string _name = network->object.getName();
-        std::unique_ptr<char[]> netName(new char[_name.length() + 1]);
-        *name = netName.release();
-        memcpy(*name, _name.c_str(), _name.length() + 1);
+        core->object.SetConfig(handle->string_map, device_name != nullptr ? device_name : "");
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -593,18 +1431,18 @@ IEStatusCode ie_network_get_name(const ie_network_t *network, char **name) {
     return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_get_inputs_number(const ie_network_t *network, size_t *size_result) {
+IEStatusCode ie_core_register_plugin(ie_core_t *core, const char *plugin_name, const char *device_name ) {
     IEStatusCode status = IEStatusCode::OK;
-    if (network == nullptr || size_result == nullptr) {
+
+    if (core == nullptr || plugin_name == nullptr || device_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        *size_result = inputs.size();
+        core->object.RegisterPlugin(plugin_name, device_name);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -612,30 +1450,18 @@ IEStatusCode ie_network_get_inputs_number(const ie_network_t *network, size_t *s
     return status;
 }
 
-IEStatusCode ie_network_get_input_name(const ie_network_t *network, size_t number, char **name) {
-    if (network == nullptr || name == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
-    }
-
+IEStatusCode ie_core_register_plugins(ie_core_t *core, const char *xml_config_file) {
     IEStatusCode status = IEStatusCode::OK;
 
-    try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
+    if (core == nullptr || xml_config_file == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
 
-        // check if the number is out of bounds.
-        if (number < 0 || number >= inputs.size()) {
-            status = IEStatusCode::OUT_OF_BOUNDS;
-        } else {
-            IE::InputsDataMap::iterator iter = inputs.begin();
-            for (size_t i = 0; i < number; ++i) {
-                ++iter;
-            }
-            std::unique_ptr<char[]> inputName(new char[iter->first.length() + 1]);
-            *name = inputName.release();
-            memcpy(*name, iter->first.c_str(), iter->first.length() + 1);
-        }
+    try {
+        core->object.RegisterPlugins(xml_config_file);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -643,24 +1469,18 @@ IEStatusCode ie_network_get_input_name(const ie_network_t *network, size_t numbe
     return status;
 }
 
-IEStatusCode ie_network_get_input_precision(const ie_network_t *network, const char *input_name, precision_e *prec_result) {
+IEStatusCode ie_core_unregister_plugin(ie_core_t *core, const char *device_name) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || input_name == nullptr || prec_result == nullptr) {
+    if (core == nullptr || device_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Precision p = inputs[input_name]->getPrecision();
-            *prec_result = precision_map[p];
-        }
+        core->object.UnregisterPlugin(device_name);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -668,30 +1488,20 @@ IEStatusCode ie_network_get_input_precision(const ie_network_t *network, const c
     return status;
 }
 
-IEStatusCode ie_network_set_input_precision(ie_network_t *network, const char *input_name, const precision_e p) {
+IEStatusCode ie_core_add_extension(ie_core_t *core, const char *extension_path, const char *device_name) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || input_name == nullptr) {
+    if (core == nullptr || extension_path == nullptr || device_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Precision precision;
-            for (auto it : precision_map) {
-                if (it.second == p) {
-                    precision = it.first;
-                    break;
-                }
-            }
-            inputs[input_name]->setPrecision(precision);
-        }
+        auto extension_ptr = InferenceEngine::make_so_pointer<InferenceEngine::IExtension>(extension_path);
+        auto extension = std::dynamic_pointer_cast<InferenceEngine::IExtension>(extension_ptr);
+        core->object.AddExtension(extension, device_name);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -699,24 +1509,19 @@ IEStatusCode ie_network_set_input_precision(ie_network_t *network, const char *i
     return status;
 }
 
-IEStatusCode ie_network_get_input_layout(const ie_network_t *network, const char *input_name, layout_e *layout_result) {
+IEStatusCode ie_core_get_metric(const ie_core_t *core, const char *device_name, const char *metric_name, ie_param_t *param_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || input_name == nullptr || layout_result == nullptr) {
+    if (core == nullptr || device_name == nullptr || metric_name == nullptr || param_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Layout l = inputs[input_name]->getLayout();
-            *layout_result = layout_map[l];
-        }
+        IE::Parameter param = core->object.GetMetric(device_name, metric_name);
+        parameter2IEparam(param, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -724,30 +1529,21 @@ IEStatusCode ie_network_get_input_layout(const ie_network_t *network, const char
     return status;
 }
 
-IEStatusCode ie_network_set_input_layout(ie_network_t *network, const char *input_name, const layout_e l) {
+IEStatusCode ie_core_get_config(const ie_core_t *core, const char *device_name, const char *config_name, ie_param_t *param_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || input_name == nullptr) {
+    if (core == nullptr || device_name == nullptr || config_name == nullptr || param_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Layout layout = IE::Layout::NCHW;
-            for (auto it : layout_map) {
-                if (it.second == l) {
-                    layout = it.first;
-                    break;
-                }
-            }
-            inputs[input_name]->setLayout(layout);
-        }
+        IE::Parameter param = core->object.GetConfig(device_name, config_name);
+
+        // convert the parameter to ie_param_t
+        parameter2IEparam(param, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -755,139 +1551,359 @@ IEStatusCode ie_network_set_input_layout(ie_network_t *network, const char *inpu
     return status;
 }
 
-IEStatusCode ie_network_get_input_dims(const ie_network_t *network, const char *input_name, dimensions_t *dims_result) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (network == nullptr || input_name == nullptr || dims_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
-    }
+IEStatusCode ie_core_get_metric_v2(const ie_core_t *core, const char *device_name, const char *metric_name, ie_param_v2_t *param_result) {
+    if (core == nullptr || device_name == nullptr || metric_name == nullptr || param_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::SizeVector dims = inputs[input_name]->getTensorDesc().getDims();
-            dims_result->ranks = dims.size();
-            for (size_t i = 0; i< dims_result->ranks; ++i) {
-                dims_result->dims[i] = dims[i];
-            }
-        }
+        IE::Parameter param = core->object.GetMetric(device_name, metric_name);
+        return parameter2IEparamV2(param, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
-
-    return status;
 }
 
-IEStatusCode ie_network_get_input_resize_algorithm(const ie_network_t *network, const char *input_name, resize_alg_e *resize_alg_result) {
-    IEStatusCode status = IEStatusCode::OK;
-
-    if (network == nullptr || input_name == nullptr || resize_alg_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_core_get_config_v2(const ie_core_t *core, const char *device_name, const char *config_name, ie_param_v2_t *param_result) {
+    if (core == nullptr || device_name == nullptr || config_name == nullptr || param_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::ResizeAlgorithm resize = inputs[input_name]->getPreProcess().getResizeAlgorithm();
-            *resize_alg_result = resize_alg_map[resize];
-        }
+        IE::Parameter param = core->object.GetConfig(device_name, config_name);
+        return parameter2IEparamV2(param, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
+}
 
-    return status;
+namespace {
+
+typedef std::chrono::steady_clock autotune_clock;
+
+struct autotune_trial {
+    std::map<std::string, std::string> config;
+    size_t num_requests = 0;
+    double throughput = 0.0;
+    double p50_ms = 0.0;
+    double p99_ms = 0.0;
+};
+
+/**
+ *@brief run num_requests requests back to back until the deadline and collect latencies.
+ * Returns false when no inference succeeded.
+ */
+bool autotuneMeasure(IE::ExecutableNetwork &exe_net, autotune_trial &trial, autotune_clock::time_point deadline, std::mt19937 &gen) {
+    std::vector<IE::InferRequest> requests(trial.num_requests);
+    std::vector<autotune_clock::time_point> started(trial.num_requests);
+    for (auto &request : requests) {
+        request = exe_net.CreateInferRequest();
+        fillSyntheticInputs(exe_net, request, gen);
+    }
+
+    // the first inference pays for lazy allocations, keep it out of the measurement
+    requests[0].Infer();
+
+    // completions are timestamped and restarted from the callbacks, in the order the requests finish
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<double> latencies;
+    size_t num_active = requests.size();
+    for (size_t i = 0; i < requests.size(); ++i) {
+        requests[i].SetCompletionCallback(std::function<void(IE::InferRequest, IE::StatusCode)>(
+            [&, i](IE::InferRequest, IE::StatusCode status_code) {
+                auto now = autotune_clock::now();
+                std::unique_lock<std::mutex> lock(mutex);
+                if (status_code == IE::StatusCode::OK) {
+                    latencies.push_back(std::chrono::duration<double, std::milli>(now - started[i]).count());
+                    if (now < deadline) {
+                        started[i] = now;
+                        lock.unlock();
+                        try {
+                            requests[i].StartAsync();
+                            return;
+                        } catch (...) {
+                        }
+                        lock.lock();
+                    }
+                }
+                // notify under the lock, the waiter returns and destroys the state as soon as no request is active
+                --num_active;
+                cv.notify_all();
+            }));
+    }
+
+    auto begin = autotune_clock::now();
+    for (size_t i = 0; i < requests.size(); ++i) {
+        started[i] = autotune_clock::now();
+        try {
+            requests[i].StartAsync();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            --num_active;
+        }
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&num_active] { return num_active == 0; });
+    double elapsed = std::chrono::duration<double>(autotune_clock::now() - begin).count();
+
+    if (latencies.empty()) {
+        return false;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    trial.throughput = elapsed > 0 ? latencies.size() / elapsed : 0.0;
+    trial.p50_ms = latencies[latencies.size() / 2];
+    trial.p99_ms = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+    return true;
 }
 
-IEStatusCode ie_network_set_input_resize_algorithm(ie_network_t *network, const char *input_name, const resize_alg_e resize_algo) {
-    IEStatusCode status = IEStatusCode::OK;
+bool autotuneBetter(const autotune_trial &a, const autotune_trial &b, const ie_autotune_objective_t *objective) {
+    if (b.num_requests == 0) {
+        return true;
+    }
+    if (objective->goal == autotune_goal_e::LATENCY_UNDER_SLO) {
+        bool a_ok = a.p99_ms <= objective->latency_slo_ms;
+        bool b_ok = b.p99_ms <= objective->latency_slo_ms;
+        if (a_ok != b_ok) {
+            return a_ok;
+        }
+        if (!a_ok) {
+            return a.p99_ms < b.p99_ms;
+        }
+    }
+    return a.throughput > b.throughput;
+}
 
-    if (network == nullptr || input_name == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+}  // namespace
+
+IEStatusCode ie_core_autotune(ie_core_t *core, const ie_network_t *network, const char *device_name, \
+        const ie_autotune_objective_t *objective, const int64_t budget_ms, ie_config_t **best_config, ie_autotune_report_t *report) {
+    if (core == nullptr || network == nullptr || device_name == nullptr || objective == nullptr || best_config == nullptr || budget_ms <= 0) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::ResizeAlgorithm resize = IE::ResizeAlgorithm::NO_RESIZE;
-            for (auto it : resize_alg_map) {
-                if (it.second == resize_algo) {
-                    resize = it.first;
-                    break;
+        auto deadline = autotune_clock::now() + std::chrono::milliseconds(budget_ms);
+        unsigned int hw_threads = std::max(1u, std::thread::hardware_concurrency());
+
+        std::vector<std::string> keys;
+        try {
+            keys = core->object.GetMetric(device_name, METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
+        } catch (...) {
+            // virtual devices such as MULTI or HETERO may not report their keys, tune the requests only
+        }
+
+        std::string streams_key, threads_key;
+        for (const auto &key : keys) {
+            if (key.size() > 19 && key.compare(key.size() - 19, 19, "_THROUGHPUT_STREAMS") == 0) {
+                streams_key = key;
+            } else if (key == CONFIG_KEY(CPU_THREADS_NUM)) {
+                threads_key = key;
+            }
+        }
+
+        std::vector<unsigned int> streams_values = {0};
+        if (!streams_key.empty()) {
+            unsigned int max_streams = hw_threads;
+            try {
+                auto range = core->object.GetMetric(device_name, METRIC_KEY(RANGE_FOR_STREAMS)).as<std::tuple<unsigned int, unsigned int>>();
+                max_streams = std::max(1u, std::get<1>(range));
+            } catch (...) {
+            }
+            streams_values.clear();
+            for (unsigned int n = 1; n < max_streams; n *= 2) {
+                streams_values.push_back(n);
+            }
+            streams_values.push_back(max_streams);
+        }
+
+        std::vector<unsigned int> threads_values = {0};
+        if (!threads_key.empty() && hw_threads > 1) {
+            threads_values.push_back(hw_threads / 2);
+        }
+
+        std::vector<std::map<std::string, std::string>> loads;
+        for (auto streams : streams_values) {
+            for (auto threads : threads_values) {
+                std::map<std::string, std::string> conf;
+                if (streams) {
+                    conf[streams_key] = std::to_string(streams);
+                }
+                if (threads) {
+                    conf[threads_key] = std::to_string(threads);
                 }
+                loads.push_back(conf);
+            }
+        }
+
+        std::mt19937 gen(0);
+        autotune_trial best;
+        size_t num_trials = 0;
+        // a configuration the device rejects or fails to run is skipped, the best of the others is kept
+        IEStatusCode trial_status = IEStatusCode::OK;
+        for (size_t l = 0; l < loads.size(); ++l) {
+            auto load_begin = autotune_clock::now();
+            if (l > 0 && load_begin >= deadline) {
+                break;
+            }
+            try {
+                IE::ExecutableNetwork exe_net = core->object.LoadNetwork(network->object, device_name, loads[l]);
+
+                size_t streams = 1;
+                auto it = loads[l].find(streams_key);
+                if (it != loads[l].end()) {
+                    streams = std::max<size_t>(std::stoul(it->second), 1);
+                }
+                std::vector<size_t> requests_values = {streams, 2 * streams};
+
+                // split what is left of the budget evenly between the remaining loads and their request counts
+                auto slice = (deadline - autotune_clock::now()) / static_cast<int>(loads.size() - l);
+                for (auto num_requests : requests_values) {
+                    autotune_trial trial;
+                    trial.config = loads[l];
+                    trial.num_requests = num_requests;
+                    try {
+                        if (!autotuneMeasure(exe_net, trial, autotune_clock::now() + slice / static_cast<int>(requests_values.size()), gen)) {
+                            trial_status = IEStatusCode::GENERAL_ERROR;
+                            continue;
+                        }
+                    } catch (const IE::details::InferenceEngineException& e) {
+                        trial_status = e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+                        continue;
+                    }
+                    ++num_trials;
+                    if (autotuneBetter(trial, best, objective)) {
+                        best = trial;
+                    }
+                }
+            } catch (const IE::details::InferenceEngineException& e) {
+                trial_status = e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+            } catch (const std::logic_error &) {
+                // a stream count the conversion rejects
+                trial_status = IEStatusCode::GENERAL_ERROR;
+            }
+        }
+        if (num_trials == 0) {
+            return trial_status == IEStatusCode::OK ? IEStatusCode::GENERAL_ERROR : trial_status;
+        }
+
+        if (objective->persist_path) {
+            std::ofstream out(objective->persist_path);
+            if (!out) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            out << "# device " << device_name << ", " << best.num_requests << " infer requests, "
+                << best.throughput << " FPS, p99 " << best.p99_ms << " ms" << std::endl;
+            for (const auto &kv : best.config) {
+                out << kv.first << " " << kv.second << std::endl;
             }
-            inputs[input_name]->getPreProcess().setResizeAlgorithm(resize);
         }
+
+        if (report) {
+            report->num_requests = best.num_requests;
+            report->num_trials = num_trials;
+            report->throughput = best.throughput;
+            report->p50_latency_ms = best.p50_ms;
+            report->p99_latency_ms = best.p99_ms;
+        }
+        *best_config = map2Config(best.config);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_get_color_format(const ie_network_t *network, const char *input_name, colorformat_e *colformat_result) {
-     IEStatusCode status = IEStatusCode::OK;
-
-    if (network == nullptr || input_name == nullptr || colformat_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_config_load(const char *path, ie_config_t **config) {
+    if (path == nullptr || config == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-            IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::ColorFormat color = inputs[input_name]->getPreProcess().getColorFormat();
-            *colformat_result = colorformat_map[color];
+        std::ifstream in(path);
+        if (!in) {
+            return IEStatusCode::NOT_FOUND;
         }
-    } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+
+        std::map<std::string, std::string> m;
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string name, value;
+            if (fields >> name >> value) {
+                m[name] = value;
+            }
+        }
+        *config = map2Config(m);
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_set_color_format(ie_network_t *network, const char *input_name, const colorformat_e color_format) {
-    IEStatusCode status = IEStatusCode::OK;
+void ie_config_free(ie_config_t **config) {
+    if (config) {
+        ie_config_t *node = *config;
+        while (node) {
+            ie_config_t *next = node->next;
+            delete[] node->name;
+            delete[] node->value;
+            delete node;
+            node = next;
+        }
+        *config = NULL;
+    }
+}
 
-    if (network == nullptr || input_name == nullptr) {
+void ie_exec_network_free(ie_executable_network_t **ie_exec_network) {
+    if (ie_exec_network) {
+        delete *ie_exec_network;
+        *ie_exec_network = NULL;
+    }
+}
+
+IEStatusCode ie_exec_network_create_infer_request(ie_executable_network_t *ie_exec_network, ie_infer_request_t **request) {
+    IEStatusCode status = IEStatusCode::OK;
+    if (ie_exec_network == nullptr || request == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
-        return status;
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::InputsDataMap inputs = network->object.getInputsInfo();
-        if (inputs.find(input_name) == inputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::ColorFormat color = IE::ColorFormat::RGB;
-            for (auto it : colorformat_map) {
-                if (it.second == color_format) {
-                    color = it.first;
-                    break;
-                }
-            }
-            inputs[input_name]->getPreProcess().setColorFormat(color);
+        std::unique_ptr<ie_infer_request_t> req(new ie_infer_request_t);
+        req->object = ie_exec_network->object.CreateInferRequest();
+        req->dyn_batch_limit = ie_exec_network->dyn_batch_limit;
+
+        std::map<std::string, size_t> port_bytes;
+        size_t blob_bytes = 0;
+        for (const auto &input : ie_exec_network->object.GetInputsInfo()) {
+            blob_bytes += port_bytes[input.first] = req->object.GetBlob(input.first)->byteSize();
         }
+        for (const auto &output : ie_exec_network->object.GetOutputsInfo()) {
+            blob_bytes += port_bytes[output.first] = req->object.GetBlob(output.first)->byteSize();
+        }
+        exec_memory &exec_mem = *ie_exec_network->memory;
+        {
+            std::lock_guard<std::mutex> lock(exec_mem.mutex);
+            exec_mem.port_bytes.swap(port_bytes);
+        }
+        req->mem.setData(MEM_DATA_REQUEST_BLOBS, blob_bytes);
+        req->exec_mem = ie_exec_network->memory;
+        exec_mem.num_requests.fetch_add(1, std::memory_order_relaxed);
+        exec_mem.request_blob_bytes.fetch_add(blob_bytes, std::memory_order_relaxed);
+        *request = req.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -895,88 +1911,133 @@ IEStatusCode ie_network_set_color_format(ie_network_t *network, const char *inpu
     return status;
 }
 
-IEStatusCode ie_network_get_input_shapes(ie_network *network, input_shapes_t *shapes) {
-    if (network == nullptr || shapes == nullptr) {
+IEStatusCode ie_exec_network_export(ie_executable_network_t *ie_exec_network, const char *file_name) {
+    if (ie_exec_network == nullptr || file_name == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
     }
 
-    IEStatusCode status = IEStatusCode::OK;
     try {
-        IE::ICNNNetwork::InputShapes net_shapes =  network->object.getInputShapes();
-        size_t num = net_shapes.size();
-
-        std::unique_ptr<input_shape[]> shape_ptrs(new input_shape[num]);
-
-        assert(shape_ptrs);
-
-        shapes->shape_num = num;
-
-        IE::ICNNNetwork::InputShapes::iterator iter = net_shapes.begin();
-        for (size_t i = 0; i < num; ++i, ++iter) {
-            IE::SizeVector net_dim = iter->second;
-
-            std::unique_ptr<char[]> _name(new char[iter->first.length() + 1]);
-            shape_ptrs[i].name = _name.release();
-            memcpy(shape_ptrs[i].name, iter->first.c_str(), iter->first.length() + 1);
-
-            shape_ptrs[i].shape.ranks = net_dim.size();
-            for (size_t j = 0; j < shape_ptrs[i].shape.ranks; ++j) {
-                shape_ptrs[i].shape.dims[j] = net_dim[j];
-            }
-        }
-        shapes->shapes = shape_ptrs.release();
-        status = IEStatusCode::OK;
+        ie_exec_network->object.Export(file_name);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_reshape(ie_network_t *network, const input_shapes_t shapes) {
-    IEStatusCode status = IEStatusCode::OK;
+IEStatusCode ie_exec_network_get_private_memory(const ie_executable_network_t *ie_exec_network, size_t *private_bytes) {
+    if (ie_exec_network == nullptr || private_bytes == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (!ie_exec_network->weights) {
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
 
-    if (network == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+    *private_bytes = ie_exec_network->mem.data_bytes;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_exec_network_warmup(ie_executable_network_t *ie_exec_network, ie_infer_request_t **requests, \
+        size_t num_requests, size_t n_iters, warmup_fill_e fill_mode, ie_warmup_report_t *report) {
+    if (ie_exec_network == nullptr || (requests != nullptr && num_requests == 0)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    for (size_t i = 0; requests != nullptr && i < num_requests; ++i) {
+        if (requests[i] == nullptr) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
     }
 
     try {
-        IE::ICNNNetwork::InputShapes net_shapes;
-        for (size_t i = 0; i < shapes.shape_num; ++i) {
-            IE::SizeVector net_dim;
-            for (size_t j = 0; j < shapes.shapes[i].shape.ranks; ++j) {
-                net_dim.push_back(shapes.shapes[i].shape.dims[j]);
+        IE::ExecutableNetwork &exe_net = ie_exec_network->object;
+        std::vector<IE::InferRequest> created;
+        if (requests == nullptr) {
+            if (num_requests == 0) {
+                try {
+                    num_requests = exe_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+                } catch (...) {
+                }
+                num_requests = std::max<size_t>(num_requests, 1);
+            }
+            for (size_t i = 0; i < num_requests; ++i) {
+                created.push_back(exe_net.CreateInferRequest());
+            }
+        }
+        n_iters = std::max<size_t>(n_iters, 1);
+
+        std::mt19937 gen(0);
+        std::vector<IE::InferRequest *> warmed(num_requests);
+        for (size_t i = 0; i < num_requests; ++i) {
+            if (requests) {
+                // warm-up outputs come from synthetic inputs, the cache or the gate of the request must not keep them
+                requests[i]->cache_pending = false;
+                requests[i]->gate_pending = false;
             }
+            warmed[i] = requests ? &requests[i]->object : &created[i];
+            IE::InferRequest &request = *warmed[i];
+            if (fill_mode == warmup_fill_e::WARMUP_FILL_RANDOM) {
+                fillSyntheticInputs(exe_net, request, gen);
+            } else {
+                for (const auto &input : exe_net.GetInputsInfo()) {
+                    IE::Blob::Ptr blob = request.GetBlob(input.first);
+                    if (blob->buffer() != nullptr) {
+                        memset(blob->buffer(), 0, blob->byteSize());
+                    }
+                }
+            }
+        }
 
-            net_shapes[shapes.shapes[i].name] = net_dim;
+        typedef std::chrono::steady_clock warmup_clock;
+        double first_ms = 0.0, last_ms = 0.0;
+        auto begin = warmup_clock::now();
+        for (size_t iter = 0; iter < n_iters; ++iter) {
+            auto round_begin = warmup_clock::now();
+            for (auto request : warmed) {
+                request->StartAsync();
+            }
+            double round_ms = 0.0;
+            for (auto request : warmed) {
+                request->Wait(IE::IInferRequest::WaitMode::RESULT_READY);
+                round_ms += std::chrono::duration<double, std::milli>(warmup_clock::now() - round_begin).count();
+            }
+            last_ms = round_ms / warmed.size();
+            if (iter == 0) {
+                first_ms = last_ms;
+            }
         }
 
-        network->object.reshape(net_shapes);
+        if (report) {
+            report->num_requests = num_requests;
+            report->num_inferences = num_requests * n_iters;
+            report->first_latency_ms = first_ms;
+            report->last_latency_ms = last_ms;
+            report->total_ms = std::chrono::duration<double, std::milli>(warmup_clock::now() - begin).count();
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_get_outputs_number(const ie_network_t *network, size_t *size_result) {
+IEStatusCode ie_exec_network_get_metric(const ie_executable_network_t *ie_exec_network, const char *metric_name, ie_param_t *param_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || size_result == nullptr) {
+    if (ie_exec_network == nullptr || metric_name == nullptr || param_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        *size_result = outputs.size();
+        InferenceEngine::Parameter parameter = ie_exec_network->object.GetMetric(metric_name);
+        parameter2IEparam(parameter, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -984,30 +2045,19 @@ IEStatusCode ie_network_get_outputs_number(const ie_network_t *network, size_t *
     return status;
 }
 
-IEStatusCode ie_network_get_output_name(const ie_network_t *network, const size_t number, char **name) {
+IEStatusCode ie_exec_network_set_config(ie_executable_network_t *ie_exec_network, const ie_config_t *param_config) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || name == nullptr) {
+    if (ie_exec_network == nullptr || param_config == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        // check if the number is out of bounds.
-        if (number < 0 || number >= outputs.size()) {
-            status = IEStatusCode::OUT_OF_BOUNDS;
-        } else {
-            IE::OutputsDataMap::iterator iter = outputs.begin();
-            for (size_t i = 0; i < number; ++i) {
-                ++iter;
-            }
-            std::unique_ptr<char[]> outputName(new char[iter->first.length() + 1]);
-            *name = outputName.release();
-            memcpy(*name, iter->first.c_str(), iter->first.length() + 1);
-        }
+        const std::map<std::string, IE::Parameter> conf_map = config2ParamMap(param_config);
+        ie_exec_network->object.SetConfig(conf_map);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1015,55 +2065,35 @@ IEStatusCode ie_network_get_output_name(const ie_network_t *network, const size_
     return status;
 }
 
-IEStatusCode ie_network_get_output_precision(const ie_network_t *network, const char *output_name, precision_e *prec_result) {
-     IEStatusCode status = IEStatusCode::OK;
-
-    if (network == nullptr || output_name == nullptr || prec_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+IEStatusCode ie_exec_network_set_config_with_handle(ie_executable_network_t *ie_exec_network, const ie_config_handle_t *handle) {
+    if (ie_exec_network == nullptr || handle == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        if (outputs.find(output_name) == outputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Precision p = outputs[output_name]->getPrecision();
-            *prec_result = precision_map[p];
-        }
+        ie_exec_network->object.SetConfig(handle->param_map);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return status;
+    return IEStatusCode::OK;
 }
 
-IEStatusCode ie_network_set_output_precision(ie_network_t *network, const char *output_name, const precision_e p) {
+IEStatusCode ie_exec_network_get_config(const ie_executable_network_t *ie_exec_network, const char *metric_config, ie_param_t *param_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || output_name == nullptr) {
+    if (ie_exec_network == nullptr || metric_config == nullptr || param_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        if (outputs.find(output_name) == outputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Precision precision;
-            for (auto it : precision_map) {
-                if (it.second == p) {
-                    precision = it.first;
-                    break;
-                }
-            }
-            outputs[output_name]->setPrecision(precision);
-        }
+        InferenceEngine::Parameter parameter = ie_exec_network->object.GetConfig(metric_config);
+        parameter2IEparam(parameter, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1071,55 +2101,105 @@ IEStatusCode ie_network_set_output_precision(ie_network_t *network, const char *
     return status;
 }
 
-IEStatusCode ie_network_get_output_layout(const ie_network_t *network, const char *output_name, layout_e *layout_result) {
-     IEStatusCode status = IEStatusCode::OK;
+IEStatusCode ie_exec_network_get_metric_v2(const ie_executable_network_t *ie_exec_network, const char *metric_name, ie_param_v2_t *param_result) {
+    if (ie_exec_network == nullptr || metric_name == nullptr || param_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
 
-    if (network == nullptr || output_name == nullptr || layout_result == nullptr) {
-        status = IEStatusCode::GENERAL_ERROR;
-        return status;
+    try {
+        InferenceEngine::Parameter parameter = ie_exec_network->object.GetMetric(metric_name);
+        return parameter2IEparamV2(parameter, param_result);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+}
+
+IEStatusCode ie_exec_network_get_config_v2(const ie_executable_network_t *ie_exec_network, const char *metric_config, ie_param_v2_t *param_result) {
+    if (ie_exec_network == nullptr || metric_config == nullptr || param_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        if (outputs.find(output_name) == outputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
-        } else {
-            IE::Layout l = outputs[output_name]->getLayout();
-            *layout_result = layout_map[l];
-        }
+        InferenceEngine::Parameter parameter = ie_exec_network->object.GetConfig(metric_config);
+        return parameter2IEparamV2(parameter, param_result);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
+}
 
-    return status;
+void ie_network_free(ie_network_t **network) {
+    if (network) {
+        delete *network;
+        *network = NULL;
+    }
 }
 
-IEStatusCode ie_network_set_output_layout(ie_network_t *network, const char *output_name, const layout_e l) {
-    IEStatusCode status = IEStatusCode::OK;
+IEStatusCode ie_network_get_name(const ie_network_t *network, char **name) {
+    if (network == nullptr || name == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
 
-    if (network == nullptr || output_name == nullptr) {
+    try {
+        std::string _name = network->object.getName();
+        std::unique_ptr<char[]> netName(new char[_name.length() + 1]);
+        *name = netName.release();
+        memcpy(*name, _name.c_str(), _name.length() + 1);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_network_get_inputs_number(const ie_network_t *network, size_t *size_result) {
+    IEStatusCode status = IEStatusCode::OK;
+    if (network == nullptr || size_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        if (outputs.find(output_name) == outputs.end()) {
-            status = IEStatusCode::NOT_FOUND;
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        *size_result = inputs.size();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_network_get_input_name(const ie_network_t *network, size_t number, char **name) {
+    if (network == nullptr || name == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+
+    try {
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+
+        // check if the number is out of bounds.
+        if (number < 0 || number >= inputs.size()) {
+            status = IEStatusCode::OUT_OF_BOUNDS;
         } else {
-            IE::Layout layout = IE::Layout::NCHW;
-            for (auto it : layout_map) {
-                if (it.second == l) {
-                    layout = it.first;
-                    break;
-                }
+            IE::InputsDataMap::iterator iter = inputs.begin();
+            for (size_t i = 0; i < number; ++i) {
+                ++iter;
             }
-            outputs[output_name]->setLayout(layout);
+            std::unique_ptr<char[]> inputName(new char[iter->first.length() + 1]);
+            *name = inputName.release();
+            memcpy(*name, iter->first.c_str(), iter->first.length() + 1);
         }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1127,27 +2207,25 @@ IEStatusCode ie_network_set_output_layout(ie_network_t *network, const char *out
     return status;
 }
 
-IEStatusCode ie_network_get_output_dims(const ie_network_t *network, const char *output_name, dimensions_t *dims_result) {
+IEStatusCode ie_network_get_input_precision(const ie_network_t *network, const char *input_name, precision_e *prec_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (network == nullptr || output_name == nullptr || dims_result == nullptr) {
+    if (network == nullptr || input_name == nullptr || prec_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
-        if (outputs.find(output_name) == outputs.end()) {
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
             status = IEStatusCode::NOT_FOUND;
         } else {
-            IE::SizeVector dims = outputs[output_name]->getTensorDesc().getDims();
-            dims_result->ranks = dims.size();
-            for (size_t i = 0; i< dims_result->ranks; ++i) {
-                dims_result->dims[i] = dims[i];
-            }
+            IE::Precision p = input->second->getPrecision();
+            *prec_result = precision2IEprecision(p);
         }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1155,46 +2233,51 @@ IEStatusCode ie_network_get_output_dims(const ie_network_t *network, const char
     return status;
 }
 
-void ie_network_input_shapes_free(input_shapes_t *inputShapes) {
-    if (inputShapes) {
-        for (size_t i = 0; i < inputShapes->shape_num; ++i) {
-            delete[] inputShapes->shapes[i].name;
-            inputShapes->shapes[i].name = NULL;
-        }
-        delete[] inputShapes->shapes;
-        inputShapes->shapes = NULL;
-    }
-}
+IEStatusCode ie_network_set_input_precision(ie_network_t *network, const char *input_name, const precision_e p) {
+    IEStatusCode status = IEStatusCode::OK;
 
-void ie_network_name_free(char **name) {
-    if (*name) {
-        delete[] *name;
-        *name = NULL;
+    if (network == nullptr || input_name == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
     }
-}
 
-void ie_infer_request_free(ie_infer_request_t **infer_request) {
-    if (infer_request) {
-        delete *infer_request;
-        *infer_request = NULL;
+    try {
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Precision precision = IEprecision2precision(p);
+            input->second->setPrecision(precision);
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
     }
+
+    return status;
 }
 
-IEStatusCode ie_infer_request_get_blob(ie_infer_request_t *infer_request, const char *name, ie_blob_t **blob) {
+IEStatusCode ie_network_get_input_layout(const ie_network_t *network, const char *input_name, layout_e *layout_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr || name == nullptr || blob == nullptr) {
+    if (network == nullptr || input_name == nullptr || layout_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::Blob::Ptr blob_ptr = infer_request->object.GetBlob(name);
-        std::unique_ptr<ie_blob_t> blob_result(new ie_blob_t);
-        blob_result->object = blob_ptr;
-        *blob = blob_result.release();
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Layout l = input->second->getLayout();
+            *layout_result = layout2IElayout(l);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1202,18 +2285,25 @@ IEStatusCode ie_infer_request_get_blob(ie_infer_request_t *infer_request, const
     return status;
 }
 
-IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const char *name, const ie_blob_t *blob) {
+IEStatusCode ie_network_set_input_layout(ie_network_t *network, const char *input_name, const layout_e l) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr || name ==nullptr || blob == nullptr) {
+    if (network == nullptr || input_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        infer_request->object.SetBlob(name, blob->object);
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Layout layout = IElayout2layout(l);
+            input->second->setLayout(layout);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1221,18 +2311,28 @@ IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const
     return status;
 }
 
-IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
+IEStatusCode ie_network_get_input_dims(const ie_network_t *network, const char *input_name, dimensions_t *dims_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr) {
+    if (network == nullptr || input_name == nullptr || dims_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        infer_request->object.Infer();
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::SizeVector dims = input->second->getTensorDesc().getDims();
+            dims_result->ranks = dims.size();
+            for (size_t i = 0; i< dims_result->ranks; ++i) {
+                dims_result->dims[i] = dims[i];
+            }
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1240,18 +2340,25 @@ IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
     return status;
 }
 
-IEStatusCode ie_infer_request_infer_async(ie_infer_request_t *infer_request) {
+IEStatusCode ie_network_get_input_resize_algorithm(const ie_network_t *network, const char *input_name, resize_alg_e *resize_alg_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr) {
+    if (network == nullptr || input_name == nullptr || resize_alg_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        infer_request->object.StartAsync();
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::ResizeAlgorithm resize = input->second->getPreProcess().getResizeAlgorithm();
+            *resize_alg_result = resize2IEresize(resize);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1259,21 +2366,25 @@ IEStatusCode ie_infer_request_infer_async(ie_infer_request_t *infer_request) {
     return status;
 }
 
-IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback) {
+IEStatusCode ie_network_set_input_resize_algorithm(ie_network_t *network, const char *input_name, const resize_alg_e resize_algo) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr || callback == nullptr) {
+    if (network == nullptr || input_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        auto fun = [=]() {
-            callback->completeCallBackFunc(callback->args);
-        };
-        infer_request->object.SetCompletionCallback(fun);
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::ResizeAlgorithm resize = IEresize2resize(resize_algo);
+            input->second->getPreProcess().setResizeAlgorithm(resize);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1281,19 +2392,25 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
     return status;
 }
 
-IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
-    IEStatusCode status = IEStatusCode::OK;
+IEStatusCode ie_network_get_color_format(const ie_network_t *network, const char *input_name, colorformat_e *colformat_result) {
+     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr) {
+    if (network == nullptr || input_name == nullptr || colformat_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::StatusCode status_code = infer_request->object.Wait(timeout);
-        status = status_map[status_code];
+            IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::ColorFormat color = input->second->getPreProcess().getColorFormat();
+            *colformat_result = colorformat2IEcolorformat(color);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1301,18 +2418,25 @@ IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int6
     return status;
 }
 
-IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size) {
+IEStatusCode ie_network_set_color_format(ie_network_t *network, const char *input_name, const colorformat_e color_format) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr) {
+    if (network == nullptr || input_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        infer_request->object.SetBatch(size);
+        IE::InputsDataMap inputs = network->object.getInputsInfo();
+        IE::InputsDataMap::iterator input = inputs.find(input_name);
+        if (input == inputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::ColorFormat color = IEcolorformat2colorformat(color_format);
+            input->second->getPreProcess().setColorFormat(color);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1320,59 +2444,39 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
-IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
-    if (tensorDesc == nullptr || blob == nullptr) {
+IEStatusCode ie_network_get_input_shapes(ie_network *network, input_shapes_t *shapes) {
+    if (network == nullptr || shapes == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
     }
 
-    IE::Precision prec;
-    for (auto it : precision_map) {
-        if (it.second == tensorDesc->precision) {
-            prec = it.first;
-            break;
-        }
-    }
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        IE::ICNNNetwork::InputShapes net_shapes =  network->object.getInputShapes();
+        size_t num = net_shapes.size();
 
-    IE::Layout l = IE::Layout::NCHW;
-    for (auto it : layout_map) {
-        if (it.second == tensorDesc->layout) {
-            l = it.first;
-            break;
-        }
-    }
+        std::unique_ptr<input_shape[]> shape_ptrs(new input_shape[num]);
 
-    IE::SizeVector dims_vector;
-    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
-        dims_vector.push_back(tensorDesc->dims.dims[i]);
-    }
+        assert(shape_ptrs);
 
-    IEStatusCode status = IEStatusCode::OK;
-    try {
-        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        IE::TensorDesc tensor(prec, dims_vector, l);
+        shapes->shape_num = num;
 
-        if (prec == IE::Precision::U8) {
-            _blob->object = IE::make_shared_blob<uint8_t>(tensor);
-        } else if (prec == IE::Precision::U16) {
-            _blob->object = IE::make_shared_blob<uint16_t>(tensor);
-        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
-            _blob->object = IE::make_shared_blob<int8_t>(tensor);
-        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
-            _blob->object = IE::make_shared_blob<int16_t>(tensor);
-        } else if (prec == IE::Precision::I32) {
-            _blob->object = IE::make_shared_blob<int32_t>(tensor);
-        } else if (prec == IE::Precision::I64) {
-            _blob->object = IE::make_shared_blob<int64_t>(tensor);
-        } else if  (prec == IE::Precision::FP32) {
-            _blob->object = IE::make_shared_blob<float>(tensor);
-        } else {
-            _blob->object = IE::make_shared_blob<uint8_t>(tensor);
-        }
+        IE::ICNNNetwork::InputShapes::iterator iter = net_shapes.begin();
+        for (size_t i = 0; i < num; ++i, ++iter) {
+            IE::SizeVector net_dim = iter->second;
 
-        _blob->object->allocate();
-        *blob = _blob.release();
+            std::unique_ptr<char[]> _name(new char[iter->first.length() + 1]);
+            shape_ptrs[i].name = _name.release();
+            memcpy(shape_ptrs[i].name, iter->first.c_str(), iter->first.length() + 1);
+
+            shape_ptrs[i].shape.ranks = net_dim.size();
+            for (size_t j = 0; j < shape_ptrs[i].shape.ranks; ++j) {
+                shape_ptrs[i].shape.dims[j] = net_dim[j];
+            }
+        }
+        shapes->shapes = shape_ptrs.release();
+        status = IEStatusCode::OK;
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1380,64 +2484,28 @@ IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **bl
     return status;
 }
 
-IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob) {
-    if (tensorDesc == nullptr || ptr == nullptr || blob == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
-    }
-
-    IE::Precision prec;
-    for (auto it : precision_map) {
-        if (it.second == tensorDesc->precision) {
-            prec = it.first;
-            break;
-        }
-    }
-
-    IE::Layout l = IE::Layout::NCHW;
-    for (auto it : layout_map) {
-        if (it.second == tensorDesc->layout) {
-            l = it.first;
-            break;
-        }
-    }
+IEStatusCode ie_network_reshape(ie_network_t *network, const input_shapes_t shapes) {
+    IEStatusCode status = IEStatusCode::OK;
 
-    IE::SizeVector dims_vector;
-    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
-        dims_vector.push_back(tensorDesc->dims.dims[i]);
+    if (network == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
     }
 
-    IEStatusCode status = IEStatusCode::OK;
     try {
-        IE::TensorDesc tensor(prec, dims_vector, l);
-        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        if (prec == IE::Precision::U8) {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U16) {
-            uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
-            int8_t *p = reinterpret_cast<int8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
-            int16_t *p = reinterpret_cast<int16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I32) {
-            int32_t *p = reinterpret_cast<int32_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I64) {
-            int64_t *p = reinterpret_cast<int64_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if  (prec == IE::Precision::FP32) {
-            float *p = reinterpret_cast<float *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
+        IE::ICNNNetwork::InputShapes net_shapes;
+        for (size_t i = 0; i < shapes.shape_num; ++i) {
+            IE::SizeVector net_dim;
+            for (size_t j = 0; j < shapes.shapes[i].shape.ranks; ++j) {
+                net_dim.push_back(shapes.shapes[i].shape.dims[j]);
+            }
+
+            net_shapes[shapes.shapes[i].name] = net_dim;
         }
-        *blob = _blob.release();
+
+        network->object.reshape(net_shapes);
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1445,19 +2513,19 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
     return status;
 }
 
-IEStatusCode ie_blob_make_memory_with_roi(const ie_blob_t *inputBlob, const roi_t *roi, ie_blob_t **blob) {
-    if (inputBlob == nullptr || roi == nullptr || blob == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
+IEStatusCode ie_network_get_outputs_number(const ie_network_t *network, size_t *size_result) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (network == nullptr || size_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
     }
 
-    IEStatusCode status = IEStatusCode::OK;
     try {
-        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        IE::ROI roi_d = {roi->id, roi->posX, roi->posY, roi->sizeX, roi->sizeY};
-        _blob->object = IE::make_shared_blob(inputBlob->object, roi_d);
-        *blob = _blob.release();
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        *size_result = outputs.size();
     } catch (const IE::details::InferenceEngineException& e) {
-       return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1465,112 +2533,134 @@ IEStatusCode ie_blob_make_memory_with_roi(const ie_blob_t *inputBlob, const roi_
     return status;
 }
 
-IEStatusCode ie_blob_make_memory_nv12(const ie_blob_t *y, const ie_blob_t *uv, ie_blob_t **nv12Blob) {
-    if (y == nullptr || uv == nullptr || nv12Blob == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
+IEStatusCode ie_network_get_output_name(const ie_network_t *network, const size_t number, char **name) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (network == nullptr || name == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
     }
 
     try {
-        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        _blob->object = IE::make_shared_blob<IE::NV12Blob>(y->object, uv->object);
-        *nv12Blob = _blob.release();
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        // check if the number is out of bounds.
+        if (number < 0 || number >= outputs.size()) {
+            status = IEStatusCode::OUT_OF_BOUNDS;
+        } else {
+            IE::OutputsDataMap::iterator iter = outputs.begin();
+            for (size_t i = 0; i < number; ++i) {
+                ++iter;
+            }
+            std::unique_ptr<char[]> outputName(new char[iter->first.length() + 1]);
+            *name = outputName.release();
+            memcpy(*name, iter->first.c_str(), iter->first.length() + 1);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-       return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return IEStatusCode::OK;
+    return status;
 }
 
-IEStatusCode ie_blob_make_memory_i420(const ie_blob_t *y, const ie_blob_t *u, const ie_blob_t *v, ie_blob_t **i420Blob) {
-    if (y == nullptr || u == nullptr || v == nullptr || i420Blob == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
+IEStatusCode ie_network_get_output_precision(const ie_network_t *network, const char *output_name, precision_e *prec_result) {
+     IEStatusCode status = IEStatusCode::OK;
+
+    if (network == nullptr || output_name == nullptr || prec_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
     }
 
     try {
-        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        _blob->object = IE::make_shared_blob<IE::I420Blob>(y->object, u->object, v->object);
-        *i420Blob = _blob.release();
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        IE::OutputsDataMap::iterator output = outputs.find(output_name);
+        if (output == outputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Precision p = output->second->getPrecision();
+            *prec_result = precision2IEprecision(p);
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-       return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
 
-    return IEStatusCode::OK;
+    return status;
 }
 
-IEStatusCode ie_blob_size(ie_blob_t *blob, int *size_result) {
+IEStatusCode ie_network_set_output_precision(ie_network_t *network, const char *output_name, const precision_e p) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (blob == nullptr || size_result == nullptr) {
+    if (network == nullptr || output_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
-    *size_result = blob->object->size();
+    try {
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        IE::OutputsDataMap::iterator output = outputs.find(output_name);
+        if (output == outputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Precision precision = IEprecision2precision(p);
+            output->second->setPrecision(precision);
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
 
     return status;
 }
 
-IEStatusCode ie_blob_byte_size(ie_blob_t *blob, int *bsize_result) {
-    IEStatusCode status = IEStatusCode::OK;
+IEStatusCode ie_network_get_output_layout(const ie_network_t *network, const char *output_name, layout_e *layout_result) {
+     IEStatusCode status = IEStatusCode::OK;
 
-    if (blob == nullptr || bsize_result == nullptr) {
+    if (network == nullptr || output_name == nullptr || layout_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
-    *bsize_result = blob->object->byteSize();
-
-    return status;
-}
-
-void ie_blob_deallocate(ie_blob_t **blob) {
-    if (*blob) {
-        (*blob)->object->deallocate();
-        delete *blob;
-        *blob = NULL;
-    }
-}
-
-IEStatusCode ie_blob_get_buffer(const ie_blob_t *blob, ie_blob_buffer_t *blob_buffer) {
-    if (blob == nullptr || blob_buffer == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
-    }
-
-    blob_buffer->buffer =  blob->object->buffer();
-
-    return IEStatusCode::OK;
-}
-
-IEStatusCode ie_blob_get_cbuffer(const ie_blob_t *blob, ie_blob_buffer_t *blob_cbuffer) {
-    if (blob == nullptr || blob_cbuffer == nullptr) {
-        return IEStatusCode::GENERAL_ERROR;
+    try {
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        IE::OutputsDataMap::iterator output = outputs.find(output_name);
+        if (output == outputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Layout l = output->second->getLayout();
+            *layout_result = layout2IElayout(l);
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
     }
 
-    blob_cbuffer->cbuffer =  blob->object->cbuffer();
-
-    return IEStatusCode::OK;
+    return status;
 }
 
-IEStatusCode ie_blob_get_dims(const ie_blob_t *blob, dimensions_t *dims_result) {
+IEStatusCode ie_network_set_output_layout(ie_network_t *network, const char *output_name, const layout_e l) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (blob == nullptr || dims_result == nullptr) {
+    if (network == nullptr || output_name == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::SizeVector size_vector = blob->object->getTensorDesc().getDims();
-        dims_result->ranks = size_vector.size();
-        for (size_t i = 0; i< dims_result->ranks; ++i) {
-            dims_result->dims[i] = size_vector[i];
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        IE::OutputsDataMap::iterator output = outputs.find(output_name);
+        if (output == outputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::Layout layout = IElayout2layout(l);
+            output->second->setLayout(layout);
         }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1578,19 +2668,28 @@ IEStatusCode ie_blob_get_dims(const ie_blob_t *blob, dimensions_t *dims_result)
     return status;
 }
 
-IEStatusCode ie_blob_get_layout(const ie_blob_t *blob, layout_e *layout_result) {
+IEStatusCode ie_network_get_output_dims(const ie_network_t *network, const char *output_name, dimensions_t *dims_result) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (blob == nullptr || layout_result == nullptr) {
+    if (network == nullptr || output_name == nullptr || dims_result == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::Layout l = blob->object->getTensorDesc().getLayout();
-        *layout_result = layout_map[l];
+        IE::OutputsDataMap outputs = network->object.getOutputsInfo();
+        IE::OutputsDataMap::iterator output = outputs.find(output_name);
+        if (output == outputs.end()) {
+            status = IEStatusCode::NOT_FOUND;
+        } else {
+            IE::SizeVector dims = output->second->getTensorDesc().getDims();
+            dims_result->ranks = dims.size();
+            for (size_t i = 0; i< dims_result->ranks; ++i) {
+                dims_result->dims[i] = dims[i];
+            }
+        }
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1598,19 +2697,46 @@ IEStatusCode ie_blob_get_layout(const ie_blob_t *blob, layout_e *layout_result)
     return status;
 }
 
-IEStatusCode ie_blob_get_precision(const ie_blob_t *blob, precision_e *prec_result) {
+void ie_network_input_shapes_free(input_shapes_t *inputShapes) {
+    if (inputShapes) {
+        for (size_t i = 0; i < inputShapes->shape_num; ++i) {
+            delete[] inputShapes->shapes[i].name;
+            inputShapes->shapes[i].name = NULL;
+        }
+        delete[] inputShapes->shapes;
+        inputShapes->shapes = NULL;
+    }
+}
+
+void ie_network_name_free(char **name) {
+    if (*name) {
+        delete[] *name;
+        *name = NULL;
+    }
+}
+
+void ie_infer_request_free(ie_infer_request_t **infer_request) {
+    if (infer_request) {
+        delete *infer_request;
+        *infer_request = NULL;
+    }
+}
+
+IEStatusCode ie_infer_request_get_blob(ie_infer_request_t *infer_request, const char *name, ie_blob_t **blob) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (blob == nullptr || prec_result == nullptr) {
+    if (infer_request == nullptr || name == nullptr || blob == nullptr) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
 
     try {
-        IE::Precision p = blob->object->getTensorDesc().getPrecision();
-        *prec_result = precision_map[p];
+        IE::Blob::Ptr blob_ptr = infer_request->object.GetBlob(name);
+        std::unique_ptr<ie_blob_t> blob_result(new ie_blob_t);
+        blob_result->object = blob_ptr;
+        *blob = blob_result.release();
     } catch (const IE::details::InferenceEngineException& e) {
-        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
     } catch (...) {
         return IEStatusCode::UNEXPECTED;
     }
@@ -1618,9 +2744,2042 @@ IEStatusCode ie_blob_get_precision(const ie_blob_t *blob, precision_e *prec_resu
     return status;
 }
 
-void ie_blob_free(ie_blob_t **blob) {
-    if (blob) {
-        delete *blob;
-        *blob = NULL;
+// Input hashing of the result cache. Stripes of 64 bytes are accumulated into 8 64-bit lanes with a
+// 32x32->64 bit multiply as in XXH3, which maps onto SSE2 and AVX2. Every path gives the same hash.
+
+const uint64_t hash_secret[16] = {
+    0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull,
+    0x78e5c0cc4ee679cbull, 0x2172ffcc7dd05a82ull, 0x8e2443f7744608b8ull, 0x4c263a81e69035e0ull,
+    0xcb00c391bb52283cull, 0xa32e531b8b65d088ull, 0x4ef90da297486471ull, 0xd8acdea946ef1938ull,
+    0x3f349ce33f76faa8ull, 0x1d4f0bc7c7bbdcf9ull, 0x3159b4cd4be0518aull, 0x647378d9c97e9fc8ull,
+};
+const uint32_t hash_prime32 = 0x9E3779B1u;
+const size_t hash_stripe = 64;
+const size_t hash_block_stripes = 8;
+
+typedef void (*hash_accumulate_fn)(uint64_t *acc, const uint8_t *data, size_t stripes, size_t first_stripe);
+typedef void (*hash_scramble_fn)(uint64_t *acc);
+
+void hashAccumulateScalar(uint64_t *acc, const uint8_t *data, size_t stripes, size_t first_stripe) {
+    for (size_t s = 0; s < stripes; ++s) {
+        const uint64_t *key = hash_secret + first_stripe + s;
+        for (size_t i = 0; i < 8; ++i) {
+            uint64_t d;
+            memcpy(&d, data + s * hash_stripe + 8 * i, sizeof(d));
+            uint64_t dk = d ^ key[i];
+            acc[i ^ 1] += d;
+            acc[i] += (dk & 0xffffffffull) * (dk >> 32);
+        }
+    }
+}
+
+void hashScrambleScalar(uint64_t *acc) {
+    for (size_t i = 0; i < 8; ++i) {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= hash_secret[8 + i];
+        acc[i] = a * hash_prime32;
+    }
+}
+
+#ifdef IE_C_API_X86_DISPATCH
+__attribute__((target("sse2"))) void hashAccumulateSse2(uint64_t *acc, const uint8_t *data, size_t stripes, size_t first_stripe) {
+    __m128i xacc[4];
+    for (size_t i = 0; i < 4; ++i) {
+        xacc[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(acc) + i);
+    }
+    for (size_t s = 0; s < stripes; ++s) {
+        const __m128i *stripe = reinterpret_cast<const __m128i *>(data + s * hash_stripe);
+        const __m128i *key = reinterpret_cast<const __m128i *>(hash_secret + first_stripe + s);
+        for (size_t i = 0; i < 4; ++i) {
+            __m128i d = _mm_loadu_si128(stripe + i);
+            __m128i dk = _mm_xor_si128(d, _mm_loadu_si128(key + i));
+            __m128i product = _mm_mul_epu32(dk, _mm_shuffle_epi32(dk, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m128i swapped = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+            xacc[i] = _mm_add_epi64(xacc[i], _mm_add_epi64(product, swapped));
+        }
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc) + i, xacc[i]);
+    }
+}
+
+__attribute__((target("sse2"))) void hashScrambleSse2(uint64_t *acc) {
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(hash_prime32));
+    for (size_t i = 0; i < 4; ++i) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(acc) + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128(reinterpret_cast<const __m128i *>(hash_secret + 8) + i));
+        __m128i product_lo = _mm_mul_epu32(a, prime);
+        __m128i product_hi = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc) + i, _mm_add_epi64(product_lo, _mm_slli_epi64(product_hi, 32)));
     }
 }
+
+__attribute__((target("avx2"))) void hashAccumulateAvx2(uint64_t *acc, const uint8_t *data, size_t stripes, size_t first_stripe) {
+    __m256i xacc[2];
+    for (size_t i = 0; i < 2; ++i) {
+        xacc[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc) + i);
+    }
+    for (size_t s = 0; s < stripes; ++s) {
+        const __m256i *stripe = reinterpret_cast<const __m256i *>(data + s * hash_stripe);
+        const __m256i *key = reinterpret_cast<const __m256i *>(hash_secret + first_stripe + s);
+        for (size_t i = 0; i < 2; ++i) {
+            __m256i d = _mm256_loadu_si256(stripe + i);
+            __m256i dk = _mm256_xor_si256(d, _mm256_loadu_si256(key + i));
+            __m256i product = _mm256_mul_epu32(dk, _mm256_shuffle_epi32(dk, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m256i swapped = _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+            xacc[i] = _mm256_add_epi64(xacc[i], _mm256_add_epi64(product, swapped));
+        }
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc) + i, xacc[i]);
+    }
+}
+
+__attribute__((target("avx2"))) void hashScrambleAvx2(uint64_t *acc) {
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(hash_prime32));
+    for (size_t i = 0; i < 2; ++i) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc) + i);
+        a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+        a = _mm256_xor_si256(a, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hash_secret + 8) + i));
+        __m256i product_lo = _mm256_mul_epu32(a, prime);
+        __m256i product_hi = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc) + i, _mm256_add_epi64(product_lo, _mm256_slli_epi64(product_hi, 32)));
+    }
+}
+#endif
+
+struct hash_kernels {
+    hash_accumulate_fn accumulate;
+    hash_scramble_fn scramble;
+};
+
+const hash_kernels &hashKernels() {
+    static const hash_kernels kernels = [] {
+#ifdef IE_C_API_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2")) {
+            return hash_kernels{hashAccumulateAvx2, hashScrambleAvx2};
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return hash_kernels{hashAccumulateSse2, hashScrambleSse2};
+        }
+#endif
+        return hash_kernels{hashAccumulateScalar, hashScrambleScalar};
+    }();
+    return kernels;
+}
+
+uint64_t hashMix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+cache_key hashBytes(const uint8_t *data, size_t size, uint64_t seed) {
+    const hash_kernels &kernels = hashKernels();
+    uint64_t acc[8];
+    for (size_t i = 0; i < 8; ++i) {
+        acc[i] = hash_secret[i] ^ seed;
+    }
+
+    const size_t block = hash_stripe * hash_block_stripes;
+    size_t full_blocks = size / block;
+    for (size_t b = 0; b < full_blocks; ++b) {
+        kernels.accumulate(acc, data + b * block, hash_block_stripes, 0);
+        // the scramble between blocks makes the hash depend on the order of the blocks
+        kernels.scramble(acc);
+    }
+    const uint8_t *tail = data + full_blocks * block;
+    size_t tail_size = size - full_blocks * block;
+    size_t stripes = tail_size / hash_stripe;
+    kernels.accumulate(acc, tail, stripes, 0);
+    if (tail_size % hash_stripe) {
+        // zero padded, the length in the final mix tells the padding from data
+        uint8_t last[hash_stripe] = {};
+        memcpy(last, tail + stripes * hash_stripe, tail_size % hash_stripe);
+        kernels.accumulate(acc, last, 1, stripes);
+    }
+
+    cache_key key = {size * 0x9E3779B185EBCA87ull ^ seed, ~size ^ hashMix(seed)};
+    for (size_t i = 0; i < 8; ++i) {
+        key.lo = hashMix(key.lo ^ (acc[i] + hash_secret[i]));
+        key.hi = hashMix(key.hi ^ (acc[i] + hash_secret[8 + i]));
+    }
+    return key;
+}
+
+/**
+ * @struct callback_queue
+ * @brief Completion callbacks of asynchronous submits served without inference.
+ */
+struct callback_queue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<ie_complete_call_back_t *> callbacks;
+    bool stopping = false;
+};
+
+/**
+ * @struct callback_notifier
+ * @brief Runs the completion callbacks of asynchronous submits served by the result cache or the frame gate on a thread
+ * started on first use, as the callback of an inference would run on a thread of the device.
+ */
+struct callback_notifier {
+    std::mutex mutex;
+    std::shared_ptr<callback_queue> queue = std::make_shared<callback_queue>();
+    std::thread thread;
+
+    void post(ie_complete_call_back_t *callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!thread.joinable()) {
+            std::shared_ptr<callback_queue> shared = queue;
+            thread = std::thread([shared] {
+                std::unique_lock<std::mutex> lock(shared->mutex);
+                while (true) {
+                    shared->cv.wait(lock, [&shared] { return shared->stopping || !shared->callbacks.empty(); });
+                    if (shared->callbacks.empty()) {
+                        return;
+                    }
+                    ie_complete_call_back_t *callback = shared->callbacks.front();
+                    shared->callbacks.pop_front();
+                    lock.unlock();
+                    {
+                        trace_span span("completion_callback");
+                        callback->completeCallBackFunc(callback->args);
+                    }
+                    lock.lock();
+                }
+            });
+        }
+        std::lock_guard<std::mutex> queue_lock(queue->mutex);
+        queue->callbacks.push_back(callback);
+        queue->cv.notify_one();
+    }
+
+    ~callback_notifier() {
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->stopping = true;
+            queue->cv.notify_all();
+        }
+        if (thread.joinable()) {
+            // the last reference may be dropped by a callback on the thread, which owns the queue and exits by itself
+            if (thread.get_id() == std::this_thread::get_id()) {
+                thread.detach();
+            } else {
+                thread.join();
+            }
+        }
+    }
+};
+
+/**
+ * @struct cache_entry
+ * @brief Outputs of an inference, by the output order of the result cache.
+ */
+struct cache_entry {
+    cache_key key;
+    std::vector<std::vector<uint8_t>> outputs;
+    std::chrono::steady_clock::time_point inserted;
+    size_t bytes = 0;
+};
+
+/**
+ * @struct result_cache_state
+ * @brief Entries of the result cache in least recently used order, shared by the handle and the infer requests.
+ */
+struct result_cache_state {
+    std::mutex mutex;
+    size_t capacity = 0;
+    std::chrono::milliseconds ttl{0};
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+    std::list<cache_entry> entries;  // most recently used first
+    std::unordered_map<cache_key, std::list<cache_entry>::iterator, cache_key_hash> index;
+    uint64_t lookups = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t insertions = 0;
+    uint64_t evictions = 0;
+    uint64_t expirations = 0;
+    uint64_t bypassed = 0;
+    size_t bytes = 0;
+    double hash_ms = 0.0;
+
+    callback_notifier notifier;
+
+    void erase(std::unordered_map<cache_key, std::list<cache_entry>::iterator, cache_key_hash>::iterator found) {
+        bytes -= found->second->bytes;
+        entries.erase(found->second);
+        index.erase(found);
+    }
+};
+
+/**
+ *@brief serves the submit from the result cache when its inputs were seen before. On a miss the key is kept to insert
+ * the outputs once the inference completes.
+ */
+bool cacheLookup(ie_infer_request_t *infer_request) {
+    result_cache_state &cache = *infer_request->result_cache;
+    infer_request->cache_pending = false;
+
+    auto begin = std::chrono::steady_clock::now();
+    cache_key key = {0, 0};
+    for (size_t i = 0; i < cache.inputs.size(); ++i) {
+        IE::Blob::Ptr blob = infer_request->object.GetBlob(cache.inputs[i]);
+        const uint8_t *data = blob->cbuffer().as<const uint8_t *>();
+        if (data == nullptr) {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            ++cache.bypassed;
+            return false;
+        }
+        key = hashBytes(data, blob->byteSize(), key.lo ^ (key.hi + i));
+    }
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.hash_ms += std::chrono::duration<double, std::milli>(now - begin).count();
+    ++cache.lookups;
+    auto found = cache.index.find(key);
+    if (found != cache.index.end() && cache.ttl.count() && now - found->second->inserted > cache.ttl) {
+        cache.erase(found);
+        ++cache.expirations;
+        found = cache.index.end();
+    }
+    if (found == cache.index.end()) {
+        ++cache.misses;
+        infer_request->cache_pending = true;
+        infer_request->pending_key = key;
+        return false;
+    }
+
+    const cache_entry &entry = *found->second;
+    for (size_t i = 0; i < cache.outputs.size(); ++i) {
+        IE::Blob::Ptr blob = infer_request->object.GetBlob(cache.outputs[i]);
+        memcpy(blob->buffer().as<uint8_t *>(), entry.outputs[i].data(), std::min(blob->byteSize(), entry.outputs[i].size()));
+    }
+    cache.entries.splice(cache.entries.begin(), cache.entries, found->second);
+    ++cache.hits;
+    infer_request->served = true;
+    return true;
+}
+
+void cacheInsert(ie_infer_request_t *infer_request) {
+    infer_request->cache_pending = false;
+    result_cache_state &cache = *infer_request->result_cache;
+
+    cache_entry entry;
+    entry.key = infer_request->pending_key;
+    entry.inserted = std::chrono::steady_clock::now();
+    for (const auto &name : cache.outputs) {
+        IE::Blob::Ptr blob = infer_request->object.GetBlob(name);
+        const uint8_t *data = blob->cbuffer().as<const uint8_t *>();
+        if (data == nullptr) {
+            return;
+        }
+        entry.outputs.emplace_back(data, data + blob->byteSize());
+        entry.bytes += blob->byteSize();
+    }
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    // requests with the same inputs in flight at the same time all miss, the first to complete inserts
+    if (cache.index.count(entry.key)) {
+        return;
+    }
+    cache.bytes += entry.bytes;
+    cache.entries.push_front(std::move(entry));
+    cache.index[cache.entries.front().key] = cache.entries.begin();
+    ++cache.insertions;
+    while (cache.entries.size() > cache.capacity) {
+        cache.erase(cache.index.find(cache.entries.back().key));
+        ++cache.evictions;
+    }
+}
+
+// Frame difference of the frame gate. Rows of the input are compared with the same rows of the reference frame, as
+// U8 or FP32 elements. Both the sum of absolute differences and the sum of squared differences are accumulated.
+
+typedef void (*frame_diff_fn)(const uint8_t *a, const uint8_t *b, size_t count, double *sad, double *ssd);
+
+void frameDiffU8Scalar(const uint8_t *a, const uint8_t *b, size_t count, double *sad, double *ssd) {
+    uint64_t abs_sum = 0, square_sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t d = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        abs_sum += d;
+        square_sum += d * d;
+    }
+    *sad += static_cast<double>(abs_sum);
+    *ssd += static_cast<double>(square_sum);
+}
+
+void frameDiffF32Scalar(const uint8_t *a, const uint8_t *b, size_t count, double *sad, double *ssd) {
+    const float *x = reinterpret_cast<const float *>(a);
+    const float *y = reinterpret_cast<const float *>(b);
+    double abs_sum = 0.0, square_sum = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        double d = static_cast<double>(x[i]) - y[i];
+        abs_sum += std::fabs(d);
+        square_sum += d * d;
+    }
+    *sad += abs_sum;
+    *ssd += square_sum;
+}
+
+#ifdef IE_C_API_X86_DISPATCH
+// 32-bit sums of squares of one 16-byte vector grow by at most 2 * 255^2 per lane, flushed to 64 bits before overflowing
+const size_t frame_diff_flush_vectors = 8192;
+
+__attribute__((target("sse2"))) void frameDiffU8Sse2(const uint8_t *a, const uint8_t *b, size_t count, double *sad, double *ssd) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i abs_sum = zero, square_sum = zero;
+    size_t i = 0;
+    while (count - i >= 16) {
+        __m128i square_block = zero;
+        for (size_t v = 0; v < frame_diff_flush_vectors && count - i >= 16; ++v, i += 16) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+            abs_sum = _mm_add_epi64(abs_sum, _mm_sad_epu8(x, y));
+            __m128i d = _mm_or_si128(_mm_subs_epu8(x, y), _mm_subs_epu8(y, x));
+            __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+            __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+            square_block = _mm_add_epi32(square_block, _mm_add_epi32(_mm_madd_epi16(d_lo, d_lo), _mm_madd_epi16(d_hi, d_hi)));
+        }
+        square_sum = _mm_add_epi64(square_sum, _mm_add_epi64(_mm_unpacklo_epi32(square_block, zero),
+                                                             _mm_unpackhi_epi32(square_block, zero)));
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), abs_sum);
+    *sad += static_cast<double>(lanes[0] + lanes[1]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), square_sum);
+    *ssd += static_cast<double>(lanes[0] + lanes[1]);
+    frameDiffU8Scalar(a + i, b + i, count - i, sad, ssd);
+}
+
+__attribute__((target("avx2"))) void frameDiffU8Avx2(const uint8_t *a, const uint8_t *b, size_t count, double *sad, double *ssd) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i abs_sum = zero, square_sum = zero;
+    size_t i = 0;
+    while (count - i >= 32) {
+        __m256i square_block = zero;
+        for (size_t v = 0; v < frame_diff_flush_vectors && count - i >= 32; ++v, i += 32) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+            abs_sum = _mm256_add_epi64(abs_sum, _mm256_sad_epu8(x, y));
+            __m256i d = _mm256_or_si256(_mm256_subs_epu8(x, y), _mm256_subs_epu8(y, x));
+            __m256i d_lo = _mm256_unpacklo_epi8(d, zero);
+            __m256i d_hi = _mm256_unpackhi_epi8(d, zero);
+            square_block = _mm256_add_epi32(square_block,
+                _mm256_add_epi32(_mm256_madd_epi16(d_lo, d_lo), _mm256_madd_epi16(d_hi, d_hi)));
+        }
+        square_sum = _mm256_add_epi64(square_sum, _mm256_add_epi64(_mm256_unpacklo_epi32(square_block, zero),
+                                                                   _mm256_unpackhi_epi32(square_block, zero)));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), abs_sum);
+    *sad += static_cast<double>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), square_sum);
+    *ssd += static_cast<double>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    frameDiffU8Scalar(a + i, b + i, count - i, sad, ssd);
+}
+
+__attribute__((target("avx2"))) void frameDiffF32Avx2(const uint8_t *a, const uint8_t *b, size_t count, double *sad, double *ssd) {
+    const float *x = reinterpret_cast<const float *>(a);
+    const float *y = reinterpret_cast<const float *>(b);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256d abs_sum = _mm256_setzero_pd(), square_sum = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i));
+        __m256 abs_d = _mm256_andnot_ps(sign, d);
+        __m256d abs_lo = _mm256_cvtps_pd(_mm256_castps256_ps128(abs_d));
+        __m256d abs_hi = _mm256_cvtps_pd(_mm256_extractf128_ps(abs_d, 1));
+        abs_sum = _mm256_add_pd(abs_sum, _mm256_add_pd(abs_lo, abs_hi));
+        square_sum = _mm256_add_pd(square_sum, _mm256_add_pd(_mm256_mul_pd(abs_lo, abs_lo), _mm256_mul_pd(abs_hi, abs_hi)));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, abs_sum);
+    *sad += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    _mm256_storeu_pd(lanes, square_sum);
+    *ssd += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    frameDiffF32Scalar(a + i * sizeof(float), b + i * sizeof(float), count - i, sad, ssd);
+}
+#endif
+
+struct frame_diff_kernels {
+    frame_diff_fn u8;
+    frame_diff_fn f32;
+};
+
+const frame_diff_kernels &frameDiffKernels() {
+    static const frame_diff_kernels kernels = [] {
+#ifdef IE_C_API_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2")) {
+            return frame_diff_kernels{frameDiffU8Avx2, frameDiffF32Avx2};
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return frame_diff_kernels{frameDiffU8Sse2, frameDiffF32Scalar};
+        }
+#endif
+        return frame_diff_kernels{frameDiffU8Scalar, frameDiffF32Scalar};
+    }();
+    return kernels;
+}
+
+/**
+ * @struct frame_gate_state
+ * @brief Sampled rows of the last inferred frame and its outputs, shared by the handle and the infer requests.
+ */
+struct frame_gate_state {
+    std::mutex mutex;
+    std::string input;
+    std::vector<std::string> outputs;
+    frame_diff_metric_e metric = frame_diff_metric_e::FRAME_DIFF_SAD;
+    size_t downsample = 1;
+    double threshold = 0.0;
+    size_t max_skip = 0;
+
+    bool has_reference = false;
+    IE::Precision reference_precision;
+    std::vector<uint8_t> reference;  // every downsample-th row of the frame
+    uint64_t sequence = 0;
+    bool outputs_ready = false;      // the inference of the reference frame has completed
+    std::vector<std::vector<uint8_t>> reference_outputs;
+    size_t skipped_in_row = 0;
+
+    uint64_t frames = 0;
+    uint64_t inferred = 0;
+    uint64_t skipped = 0;
+    uint64_t forced = 0;
+    uint64_t bypassed = 0;
+    uint64_t compared = 0;
+    double last_diff = 0.0;
+    double diff_sum = 0.0;
+    double diff_ms = 0.0;
+
+    callback_notifier notifier;
+};
+
+/**
+ *@brief compares the input of the request with the reference frame of the gate. Below the threshold, the outputs of the
+ * reference are copied to the request and no inference is needed. Otherwise the input becomes the new reference.
+ */
+bool gateCheck(ie_infer_request_t *infer_request) {
+    frame_gate_state &gate = *infer_request->frame_gate;
+    infer_request->gate_pending = false;
+
+    IE::Blob::Ptr blob = infer_request->object.GetBlob(gate.input);
+    const IE::TensorDesc &desc = blob->getTensorDesc();
+    const uint8_t *data = blob->cbuffer().as<const uint8_t *>();
+    IE::Precision precision = desc.getPrecision();
+    bool supported = precision == IE::Precision::U8 || precision == IE::Precision::FP32;
+    if (data == nullptr || !supported || blob->size() == 0) {
+        std::lock_guard<std::mutex> lock(gate.mutex);
+        ++gate.frames;
+        ++gate.bypassed;
+        return false;
+    }
+
+    // a row is the innermost dimension, with the channels of a pixel in interleaved layouts
+    const IE::SizeVector &dims = desc.getDims();
+    size_t row_elements = dims.empty() ? 1 : dims.back();
+    if (desc.getLayout() == IE::Layout::NHWC && dims.size() == 4) {
+        row_elements *= dims[1];
+    }
+    size_t element_size = precision.size();
+    size_t row_size = row_elements * element_size;
+    size_t rows = blob->byteSize() / row_size;
+    size_t sampled_rows = (rows + gate.downsample - 1) / gate.downsample;
+    frame_diff_fn diff = precision == IE::Precision::U8 ? frameDiffKernels().u8 : frameDiffKernels().f32;
+
+    std::lock_guard<std::mutex> lock(gate.mutex);
+    ++gate.frames;
+    bool comparable = gate.has_reference && gate.reference_precision == precision &&
+        gate.reference.size() == sampled_rows * row_size;
+    if (comparable && gate.outputs_ready) {
+        auto begin = std::chrono::steady_clock::now();
+        double sad = 0.0, ssd = 0.0;
+        for (size_t r = 0; r < sampled_rows; ++r) {
+            diff(data + r * gate.downsample * row_size, gate.reference.data() + r * row_size, row_elements, &sad, &ssd);
+        }
+        double elements = static_cast<double>(sampled_rows * row_elements);
+        double value = gate.metric == frame_diff_metric_e::FRAME_DIFF_MSE ? ssd / elements : sad / elements;
+        gate.diff_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        ++gate.compared;
+        gate.last_diff = value;
+        gate.diff_sum += value;
+
+        if (value <= gate.threshold) {
+            if (gate.max_skip == 0 || gate.skipped_in_row < gate.max_skip) {
+                for (size_t i = 0; i < gate.outputs.size(); ++i) {
+                    IE::Blob::Ptr output = infer_request->object.GetBlob(gate.outputs[i]);
+                    const std::vector<uint8_t> &saved = gate.reference_outputs[i];
+                    memcpy(output->buffer().as<uint8_t *>(), saved.data(), std::min(output->byteSize(), saved.size()));
+                }
+                ++gate.skipped;
+                ++gate.skipped_in_row;
+                infer_request->served = true;
+                return true;
+            }
+            ++gate.forced;
+        }
+    }
+
+    gate.reference.resize(sampled_rows * row_size);
+    for (size_t r = 0; r < sampled_rows; ++r) {
+        memcpy(gate.reference.data() + r * row_size, data + r * gate.downsample * row_size, row_size);
+    }
+    gate.has_reference = true;
+    gate.reference_precision = precision;
+    gate.outputs_ready = false;
+    gate.skipped_in_row = 0;
+    ++gate.inferred;
+    infer_request->gate_pending = true;
+    infer_request->gate_sequence = ++gate.sequence;
+    return false;
+}
+
+/**
+ *@brief keeps the outputs of the request as the outputs of the reference frame, unless a later submit has replaced it.
+ */
+void gateUpdate(ie_infer_request_t *infer_request) {
+    infer_request->gate_pending = false;
+    frame_gate_state &gate = *infer_request->frame_gate;
+
+    std::vector<std::vector<uint8_t>> outputs;
+    for (const auto &name : gate.outputs) {
+        IE::Blob::Ptr blob = infer_request->object.GetBlob(name);
+        const uint8_t *data = blob->cbuffer().as<const uint8_t *>();
+        if (data == nullptr) {
+            return;
+        }
+        outputs.emplace_back(data, data + blob->byteSize());
+    }
+
+    std::lock_guard<std::mutex> lock(gate.mutex);
+    if (infer_request->gate_sequence == gate.sequence) {
+        gate.reference_outputs.swap(outputs);
+        gate.outputs_ready = true;
+    }
+}
+
+/**
+ *@brief sets the single completion callback of the request, which inserts the outputs of a cache miss and calls the
+ * callback of the user.
+ */
+void installCompletion(ie_infer_request_t *infer_request) {
+    infer_request->object.SetCompletionCallback(std::function<void(IE::InferRequest, IE::StatusCode)>(
+        [infer_request](IE::InferRequest, IE::StatusCode status_code) {
+            infer_request->last_status = status_code;
+            // the outputs of a failed inference are neither cached nor kept by the gate, nor those of a later one
+            if (infer_request->cache_pending && status_code == IE::StatusCode::OK) {
+                cacheInsert(infer_request);
+            }
+            infer_request->cache_pending = false;
+            if (infer_request->gate_pending && status_code == IE::StatusCode::OK) {
+                gateUpdate(infer_request);
+            }
+            infer_request->gate_pending = false;
+            ie_complete_call_back_t *callback = infer_request->callback;
+            if (callback) {
+                trace_span span("completion_callback", infer_request->id);
+                callback->completeCallBackFunc(callback->args);
+            }
+        }));
+}
+
+/**
+ *@brief appends a record of the submit with the inputs set on the request to its capture log, if the submit is sampled.
+ */
+void captureSubmit(ie_infer_request_t *infer_request, bool async) {
+    capture_log &log = *infer_request->capture;
+    auto align8 = [](uint64_t size) { return (size + 7) & ~static_cast<uint64_t>(7); };
+
+    // timestamped under the lock, so that records are written in timestamp order
+    std::lock_guard<std::mutex> lock(log.mutex);
+    uint64_t timestamp_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - log.origin).count());
+    ++log.submits;
+    // evenly spaced sampling, a submit is recorded whenever submits * sample_rate reaches the next integer
+    uint64_t due = static_cast<uint64_t>(log.submits * log.sample_rate);
+    if (due == log.sampled) {
+        return;
+    }
+    log.sampled = due;
+
+    ie_capture_record_t record = {sizeof(ie_capture_record_t), timestamp_ns, infer_request->id, 0, async ? 1u : 0u};
+    std::vector<std::pair<ie_capture_input_t, const std::pair<std::string, IE::Blob::Ptr> *>> inputs;
+    for (const auto &input : infer_request->capture_inputs) {
+        const IE::Blob::Ptr &blob = input.second;
+        const IE::SizeVector &dims = blob->getTensorDesc().getDims();
+        // compound blobs have no plain buffer to record
+        if (blob->cbuffer().as<const void *>() == nullptr || dims.size() > 8) {
+            continue;
+        }
+        ie_capture_input_t header = {};
+        header.data_size = blob->byteSize();
+        header.name_size = static_cast<uint32_t>(align8(input.first.size() + 1));
+        header.precision = precision2IEprecision(blob->getTensorDesc().getPrecision());
+        header.layout = layout2IElayout(blob->getTensorDesc().getLayout());
+        header.ranks = static_cast<uint32_t>(dims.size());
+        std::copy(dims.begin(), dims.end(), header.dims);
+        record.size += sizeof(header) + header.name_size + align8(header.data_size);
+        inputs.emplace_back(header, &input);
+    }
+    record.num_inputs = static_cast<uint32_t>(inputs.size());
+    if (log.failed || (log.max_bytes && log.bytes + record.size > log.max_bytes)) {
+        ++log.dropped;
+        return;
+    }
+
+    static const char padding[8] = {};
+    auto write = [&log](const void *data, size_t size) { return fwrite(data, 1, size, log.file) == size; };
+    bool written = write(&record, sizeof(record));
+    for (size_t i = 0; written && i < inputs.size(); ++i) {
+        const ie_capture_input_t &header = inputs[i].first;
+        const std::string &name = inputs[i].second->first;
+        written = write(&header, sizeof(header)) && write(name.c_str(), name.size() + 1) &&
+                  write(padding, header.name_size - name.size() - 1) &&
+                  write(inputs[i].second->second->cbuffer().as<const void *>(), header.data_size) &&
+                  write(padding, align8(header.data_size) - header.data_size);
+    }
+    if (!written) {
+        log.failed = true;
+        ++log.dropped;
+        return;
+    }
+    ++log.recorded;
+    log.bytes += record.size;
+}
+
+IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const char *name, const ie_blob_t *blob) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || name ==nullptr || blob == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        trace_span span("ie_infer_request_set_blob", infer_request->id);
+        infer_request->object.SetBlob(name, blob->object);
+        if (infer_request->capture) {
+            auto input = std::find_if(infer_request->capture_inputs.begin(), infer_request->capture_inputs.end(),
+                [name](const std::pair<std::string, IE::Blob::Ptr> &item) { return item.first == name; });
+            if (input == infer_request->capture_inputs.end()) {
+                infer_request->capture_inputs.emplace_back(name, blob->object);
+            } else {
+                input->second = blob->object;
+            }
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        trace_span span("ie_infer_request_infer", infer_request->id);
+        if (infer_request->capture) {
+            captureSubmit(infer_request, false);
+        }
+        infer_request->served = false;
+        if (infer_request->frame_gate && gateCheck(infer_request)) {
+            return IEStatusCode::OK;
+        }
+        if (infer_request->result_cache && cacheLookup(infer_request)) {
+            if (infer_request->gate_pending) {
+                gateUpdate(infer_request);
+            }
+            return IEStatusCode::OK;
+        }
+        infer_request->object.Infer();
+        if (infer_request->cache_pending) {
+            cacheInsert(infer_request);
+        }
+        if (infer_request->gate_pending) {
+            gateUpdate(infer_request);
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_infer_async(ie_infer_request_t *infer_request) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        trace_span span("ie_infer_request_infer_async", infer_request->id);
+        if (infer_request->capture) {
+            captureSubmit(infer_request, true);
+        }
+        infer_request->served = false;
+        infer_request->last_status = IE::StatusCode::OK;
+        if (infer_request->frame_gate && gateCheck(infer_request)) {
+            if (infer_request->callback) {
+                infer_request->frame_gate->notifier.post(infer_request->callback);
+            }
+            return IEStatusCode::OK;
+        }
+        if (infer_request->result_cache && cacheLookup(infer_request)) {
+            if (infer_request->gate_pending) {
+                gateUpdate(infer_request);
+            }
+            if (infer_request->callback) {
+                infer_request->result_cache->notifier.post(infer_request->callback);
+            }
+            return IEStatusCode::OK;
+        }
+        infer_request->object.StartAsync();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || callback == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        infer_request->callback = callback;
+        installCompletion(infer_request);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        trace_span span("ie_infer_request_wait", infer_request->id);
+        // the outputs of a submit served without inference were ready when it returned
+        if (infer_request->served) {
+            return IEStatusCode::OK;
+        }
+        IE::StatusCode status_code = infer_request->object.Wait(timeout);
+        status = status2IEStatus(status_code);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode inferRequestStatus(const ie_infer_request_t *infer_request) {
+    return status2IEStatus(infer_request->last_status);
+}
+
+IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+    if (size == 0 || (infer_request->dyn_batch_limit && size > infer_request->dyn_batch_limit)) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    try {
+        infer_request->object.SetBatch(size);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_get_performance_counts(ie_infer_request_t *infer_request, ie_profiling_infos_t *perf_counts) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || perf_counts == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        std::map<std::string, IE::InferenceEngineProfileInfo> counts = infer_request->object.GetPerformanceCounts();
+        std::vector<std::pair<const std::string *, const IE::InferenceEngineProfileInfo *>> ordered;
+        ordered.reserve(counts.size());
+        for (const auto &count : counts) {
+            ordered.emplace_back(&count.first, &count.second);
+        }
+        std::stable_sort(ordered.begin(), ordered.end(), [](const decltype(ordered)::value_type &a, const decltype(ordered)::value_type &b) {
+            return a.second->execution_index < b.second->execution_index;
+        });
+
+        auto copyString = [](const std::string &str) {
+            char *copy = new char[str.length() + 1];
+            memcpy(copy, str.c_str(), str.length() + 1);
+            return copy;
+        };
+        std::unique_ptr<ie_profiling_info_t[]> infos(new ie_profiling_info_t[ordered.size()]());
+        perf_counts->num_infos = 0;
+        try {
+            for (size_t i = 0; i < ordered.size(); ++i) {
+                const IE::InferenceEngineProfileInfo &info = *ordered[i].second;
+                infos[i].layer_name = copyString(*ordered[i].first);
+                perf_counts->num_infos = i + 1;
+                infos[i].layer_type = copyString(std::string(info.layer_type, strnlen(info.layer_type, sizeof(info.layer_type))));
+                infos[i].exec_type = copyString(std::string(info.exec_type, strnlen(info.exec_type, sizeof(info.exec_type))));
+                infos[i].status = static_cast<layer_status_e>(info.status);
+                infos[i].real_time_us = info.realTime_uSec;
+                infos[i].cpu_time_us = info.cpu_uSec;
+                infos[i].execution_index = info.execution_index;
+            }
+        } catch (...) {
+            perf_counts->infos = infos.release();
+            ie_profiling_infos_free(perf_counts);
+            throw;
+        }
+        perf_counts->infos = infos.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+void ie_profiling_infos_free(ie_profiling_infos_t *perf_counts) {
+    if (perf_counts && perf_counts->infos) {
+        for (size_t i = 0; i < perf_counts->num_infos; ++i) {
+            delete[] const_cast<char *>(perf_counts->infos[i].layer_name);
+            delete[] const_cast<char *>(perf_counts->infos[i].layer_type);
+            delete[] const_cast<char *>(perf_counts->infos[i].exec_type);
+        }
+        delete[] perf_counts->infos;
+        perf_counts->infos = NULL;
+        perf_counts->num_infos = 0;
+    }
+}
+
+IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
+    if (tensorDesc == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IE::Precision prec = IEprecision2precision(tensorDesc->precision);
+
+    IE::Layout l = IElayout2layout(tensorDesc->layout);
+
+    IE::SizeVector dims_vector;
+    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
+        dims_vector.push_back(tensorDesc->dims.dims[i]);
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        IE::TensorDesc tensor(prec, dims_vector, l);
+
+        if (prec == IE::Precision::U8) {
+            _blob->object = IE::make_shared_blob<uint8_t>(tensor);
+        } else if (prec == IE::Precision::U16) {
+            _blob->object = IE::make_shared_blob<uint16_t>(tensor);
+        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
+            _blob->object = IE::make_shared_blob<int8_t>(tensor);
+        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+            _blob->object = IE::make_shared_blob<int16_t>(tensor);
+        } else if (prec == IE::Precision::I32) {
+            _blob->object = IE::make_shared_blob<int32_t>(tensor);
+        } else if (prec == IE::Precision::I64) {
+            _blob->object = IE::make_shared_blob<int64_t>(tensor);
+        } else if  (prec == IE::Precision::FP32) {
+            _blob->object = IE::make_shared_blob<float>(tensor);
+        } else {
+            _blob->object = IE::make_shared_blob<uint8_t>(tensor);
+        }
+
+        _blob->object->allocate();
+        _blob->mem.setSite(SITE_BLOB_MAKE_MEMORY);
+        _blob->mem.setData(MEM_DATA_BLOB, _blob->object->byteSize());
+        *blob = _blob.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob) {
+    if (tensorDesc == nullptr || ptr == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IE::Precision prec = IEprecision2precision(tensorDesc->precision);
+
+    IE::Layout l = IElayout2layout(tensorDesc->layout);
+
+    IE::SizeVector dims_vector;
+    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
+        dims_vector.push_back(tensorDesc->dims.dims[i]);
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        IE::TensorDesc tensor(prec, dims_vector, l);
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        if (prec == IE::Precision::U8) {
+            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::U16) {
+            uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
+            int8_t *p = reinterpret_cast<int8_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+            int16_t *p = reinterpret_cast<int16_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I32) {
+            int32_t *p = reinterpret_cast<int32_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I64) {
+            int64_t *p = reinterpret_cast<int64_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if  (prec == IE::Precision::FP32) {
+            float *p = reinterpret_cast<float *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else {
+            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        }
+        _blob->mem.setSite(SITE_BLOB_MAKE_PREALLOCATED);
+        *blob = _blob.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_blob_make_memory_with_roi(const ie_blob_t *inputBlob, const roi_t *roi, ie_blob_t **blob) {
+    if (inputBlob == nullptr || roi == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        IE::ROI roi_d = {roi->id, roi->posX, roi->posY, roi->sizeX, roi->sizeY};
+        _blob->object = IE::make_shared_blob(inputBlob->object, roi_d);
+        _blob->mem.setSite(SITE_BLOB_MAKE_ROI);
+        *blob = _blob.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+       return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_blob_make_memory_nv12(const ie_blob_t *y, const ie_blob_t *uv, ie_blob_t **nv12Blob) {
+    if (y == nullptr || uv == nullptr || nv12Blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        _blob->object = IE::make_shared_blob<IE::NV12Blob>(y->object, uv->object);
+        _blob->mem.setSite(SITE_BLOB_MAKE_NV12);
+        *nv12Blob = _blob.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+       return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_make_memory_i420(const ie_blob_t *y, const ie_blob_t *u, const ie_blob_t *v, ie_blob_t **i420Blob) {
+    if (y == nullptr || u == nullptr || v == nullptr || i420Blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        _blob->object = IE::make_shared_blob<IE::I420Blob>(y->object, u->object, v->object);
+        _blob->mem.setSite(SITE_BLOB_MAKE_I420);
+        *i420Blob = _blob.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+       return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_size(ie_blob_t *blob, int *size_result) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (blob == nullptr || size_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    *size_result = blob->object->size();
+
+    return status;
+}
+
+IEStatusCode ie_blob_byte_size(ie_blob_t *blob, int *bsize_result) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (blob == nullptr || bsize_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    *bsize_result = blob->object->byteSize();
+
+    return status;
+}
+
+void ie_blob_deallocate(ie_blob_t **blob) {
+    if (*blob) {
+        (*blob)->object->deallocate();
+        delete *blob;
+        *blob = NULL;
+    }
+}
+
+IEStatusCode ie_blob_get_buffer(const ie_blob_t *blob, ie_blob_buffer_t *blob_buffer) {
+    if (blob == nullptr || blob_buffer == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    blob_buffer->buffer =  blob->object->buffer();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_get_cbuffer(const ie_blob_t *blob, ie_blob_buffer_t *blob_cbuffer) {
+    if (blob == nullptr || blob_cbuffer == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    blob_cbuffer->cbuffer =  blob->object->cbuffer();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_get_dims(const ie_blob_t *blob, dimensions_t *dims_result) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (blob == nullptr || dims_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        IE::SizeVector size_vector = blob->object->getTensorDesc().getDims();
+        dims_result->ranks = size_vector.size();
+        for (size_t i = 0; i< dims_result->ranks; ++i) {
+            dims_result->dims[i] = size_vector[i];
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_blob_get_layout(const ie_blob_t *blob, layout_e *layout_result) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (blob == nullptr || layout_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        IE::Layout l = blob->object->getTensorDesc().getLayout();
+        *layout_result = layout2IElayout(l);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_blob_get_precision(const ie_blob_t *blob, precision_e *prec_result) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (blob == nullptr || prec_result == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        IE::Precision p = blob->object->getTensorDesc().getPrecision();
+        *prec_result = precision2IEprecision(p);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+void ie_blob_free(ie_blob_t **blob) {
+    if (blob) {
+        delete *blob;
+        *blob = NULL;
+    }
+}
+
+namespace {
+
+// Blob conversion. Elements go through FP32 in chunks small enough to stay in L1: the source is widened to FP32,
+// dequantized for U8 and I8, and narrowed to the destination precision, quantized for U8 and I8.
+
+const size_t convert_chunk = 1024;
+
+/**
+ * @struct convert_params
+ * @brief Quantization of the U8 or I8 side of a conversion, as real = scale * (q - zero_point).
+ */
+struct convert_params {
+    float scale;
+    float inv_scale;
+    int32_t zero_point;
+};
+
+typedef void (*to_float_fn)(const void *src, size_t count, const convert_params &params, float *dst);
+typedef void (*from_float_fn)(const float *src, size_t count, const convert_params &params, void *dst);
+
+void f32ToFloat(const void *src, size_t count, const convert_params &, float *dst) {
+    memcpy(dst, src, count * sizeof(float));
+}
+
+void f16ToFloatScalar(const void *src, size_t count, const convert_params &, float *dst) {
+    const uint16_t *halves = static_cast<const uint16_t *>(src);
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = halfToFloat(halves[i]);
+    }
+}
+
+template <class T>
+void intToFloatScalar(const void *src, size_t count, const convert_params &params, float *dst) {
+    const T *values = static_cast<const T *>(src);
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = params.scale * static_cast<float>(static_cast<int32_t>(values[i]) - params.zero_point);
+    }
+}
+
+void floatToF32(const float *src, size_t count, const convert_params &, void *dst) {
+    memcpy(dst, src, count * sizeof(float));
+}
+
+void floatToF16Scalar(const float *src, size_t count, const convert_params &, void *dst) {
+    uint16_t *halves = static_cast<uint16_t *>(dst);
+    for (size_t i = 0; i < count; ++i) {
+        halves[i] = floatToHalf(src[i]);
+    }
+}
+
+template <class T>
+void floatToIntScalar(const float *src, size_t count, const convert_params &params, void *dst) {
+    T *values = static_cast<T *>(dst);
+    const float low = static_cast<float>(std::numeric_limits<T>::min());
+    const float high = static_cast<float>(std::numeric_limits<T>::max());
+    for (size_t i = 0; i < count; ++i) {
+        // round half to even like the vector conversion, NaN goes to the zero point
+        float q = std::nearbyint(src[i] * params.inv_scale) + static_cast<float>(params.zero_point);
+        values[i] = static_cast<T>(std::min(high, std::max(low, q == q ? q : static_cast<float>(params.zero_point))));
+    }
+}
+
+#ifdef IE_C_API_X86_DISPATCH
+__attribute__((target("avx2,f16c"))) void f16ToFloatF16c(const void *src, size_t count, const convert_params &params,
+                                                         float *dst) {
+    const uint16_t *halves = static_cast<const uint16_t *>(src);
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(halves + i))));
+    }
+    f16ToFloatScalar(halves + i, count - i, params, dst + i);
+}
+
+__attribute__((target("avx2,f16c"))) void floatToF16F16c(const float *src, size_t count, const convert_params &params,
+                                                         void *dst) {
+    uint16_t *halves = static_cast<uint16_t *>(dst);
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(halves + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    floatToF16Scalar(src + i, count - i, params, halves + i);
+}
+
+__attribute__((target("avx2"))) void u8ToFloatAvx2(const void *src, size_t count, const convert_params &params, float *dst) {
+    const uint8_t *values = static_cast<const uint8_t *>(src);
+    const __m256i zero_point = _mm256_set1_epi32(params.zero_point);
+    const __m256 scale = _mm256_set1_ps(params.scale);
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        __m256i q = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(values + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(scale, _mm256_cvtepi32_ps(_mm256_sub_epi32(q, zero_point))));
+    }
+    intToFloatScalar<uint8_t>(values + i, count - i, params, dst + i);
+}
+
+__attribute__((target("avx2"))) void i8ToFloatAvx2(const void *src, size_t count, const convert_params &params, float *dst) {
+    const int8_t *values = static_cast<const int8_t *>(src);
+    const __m256i zero_point = _mm256_set1_epi32(params.zero_point);
+    const __m256 scale = _mm256_set1_ps(params.scale);
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        __m256i q = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(values + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(scale, _mm256_cvtepi32_ps(_mm256_sub_epi32(q, zero_point))));
+    }
+    intToFloatScalar<int8_t>(values + i, count - i, params, dst + i);
+}
+
+/**
+ *@brief quantizes 8 values to 32-bit integers clamped to [low, high], then gathers their low bytes.
+ */
+__attribute__((target("avx2"))) void floatToIntAvx2(const float *src, size_t count, const convert_params &params, void *dst,
+                                                    int32_t low, int32_t high) {
+    uint8_t *bytes = static_cast<uint8_t *>(dst);
+    const __m256 inv_scale = _mm256_set1_ps(params.inv_scale);
+    const __m256 zero_point = _mm256_set1_ps(static_cast<float>(params.zero_point));
+    const __m256 low_f = _mm256_set1_ps(static_cast<float>(low));
+    const __m256 high_f = _mm256_set1_ps(static_cast<float>(high));
+    const __m256i gather = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        __m256 x = _mm256_loadu_ps(src + i);
+        __m256 q = _mm256_add_ps(_mm256_round_ps(_mm256_mul_ps(x, inv_scale), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+                                 zero_point);
+        // NaN compares false and takes the zero point
+        q = _mm256_blendv_ps(zero_point, q, _mm256_cmp_ps(q, q, _CMP_ORD_Q));
+        q = _mm256_min_ps(high_f, _mm256_max_ps(low_f, q));
+        __m256i packed = _mm256_shuffle_epi8(_mm256_cvtps_epi32(q), gather);
+        __m128i result = _mm_unpacklo_epi32(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(bytes + i), result);
+    }
+    if (low == 0) {
+        floatToIntScalar<uint8_t>(src + i, count - i, params, bytes + i);
+    } else {
+        floatToIntScalar<int8_t>(src + i, count - i, params, bytes + i);
+    }
+}
+
+__attribute__((target("avx2"))) void floatToU8Avx2(const float *src, size_t count, const convert_params &params, void *dst) {
+    floatToIntAvx2(src, count, params, dst, 0, 255);
+}
+
+__attribute__((target("avx2"))) void floatToI8Avx2(const float *src, size_t count, const convert_params &params, void *dst) {
+    floatToIntAvx2(src, count, params, dst, -128, 127);
+}
+#endif
+
+/**
+ * @struct convert_kernels
+ * @brief Conversions of a precision to and from FP32, picked once for the CPU.
+ */
+struct convert_kernels {
+    to_float_fn to_f32, f16_to, u8_to, i8_to;
+    from_float_fn to_f32_out, to_f16, to_u8, to_i8;
+};
+
+const convert_kernels &convertKernels() {
+    static const convert_kernels kernels = [] {
+        convert_kernels k = {f32ToFloat, f16ToFloatScalar, intToFloatScalar<uint8_t>, intToFloatScalar<int8_t>,
+                             floatToF32, floatToF16Scalar, floatToIntScalar<uint8_t>, floatToIntScalar<int8_t>};
+#ifdef IE_C_API_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2")) {
+            k.u8_to = u8ToFloatAvx2;
+            k.i8_to = i8ToFloatAvx2;
+            k.to_u8 = floatToU8Avx2;
+            k.to_i8 = floatToI8Avx2;
+            if (__builtin_cpu_supports("f16c")) {
+                k.f16_to = f16ToFloatF16c;
+                k.to_f16 = floatToF16F16c;
+            }
+        }
+#endif
+        return k;
+    }();
+    return kernels;
+}
+
+to_float_fn toFloat(const IE::Precision &precision) {
+    const convert_kernels &k = convertKernels();
+    switch (precision) {
+    case IE::Precision::FP32: return k.to_f32;
+    case IE::Precision::FP16: return k.f16_to;
+    case IE::Precision::U8: return k.u8_to;
+    case IE::Precision::I8: return k.i8_to;
+    default: return nullptr;
+    }
+}
+
+from_float_fn fromFloat(const IE::Precision &precision) {
+    const convert_kernels &k = convertKernels();
+    switch (precision) {
+    case IE::Precision::FP32: return k.to_f32_out;
+    case IE::Precision::FP16: return k.to_f16;
+    case IE::Precision::U8: return k.to_u8;
+    case IE::Precision::I8: return k.to_i8;
+    default: return nullptr;
+    }
+}
+
+convert_params convertParams(const ie_quantization_t *quantization) {
+    convert_params params = {1.0f, 1.0f, 0};
+    if (quantization) {
+        params.scale = quantization->scale;
+        params.inv_scale = 1.0f / quantization->scale;
+        params.zero_point = quantization->zero_point;
+    }
+    return params;
+}
+
+/**
+ *@brief whether the blob holds its elements contiguously in the order of its layout, unlike ROI blobs.
+ */
+bool denseBlob(const IE::TensorDesc &desc) {
+    IE::Layout layout = desc.getLayout();
+    if (layout == IE::Layout::ANY || layout == IE::Layout::BLOCKED) {
+        return false;
+    }
+    return IE::TensorDesc(desc.getPrecision(), desc.getDims(), layout).getBlockingDesc() == desc.getBlockingDesc();
+}
+
+/**
+ * @struct convert_job
+ * @brief A conversion split into rows processed independently: runs of elements, or the pixels of one row of an
+ * image transposed between NCHW and NHWC.
+ */
+struct convert_job {
+    const uint8_t *src;
+    uint8_t *dst;
+    size_t src_element;
+    size_t dst_element;
+    to_float_fn to;
+    from_float_fn from;
+    convert_params src_params;
+    convert_params dst_params;
+    bool transpose;
+    bool to_nhwc;
+    size_t channels, height, width;
+    size_t rows;
+    size_t row_elements;
+};
+
+void convertRun(const convert_job &job, const uint8_t *src, uint8_t *dst, size_t count, float *chunk) {
+    for (size_t i = 0; i < count; i += convert_chunk) {
+        size_t n = std::min(convert_chunk, count - i);
+        job.to(src + i * job.src_element, n, job.src_params, chunk);
+        job.from(chunk, n, job.dst_params, dst + i * job.dst_element);
+    }
+}
+
+/**
+ *@brief converts the rows [first, last) of the job. A row of a transposition is one image row of all channels.
+ */
+void convertRows(const convert_job &job, size_t first, size_t last) {
+    std::vector<float> planar, interleaved;
+    float chunk[convert_chunk];
+    if (!job.transpose) {
+        for (size_t r = first; r < last; ++r) {
+            convertRun(job, job.src + r * job.row_elements * job.src_element, job.dst + r * job.row_elements * job.dst_element,
+                       job.row_elements, chunk);
+        }
+        return;
+    }
+
+    size_t c_count = job.channels, w_count = job.width, h_count = job.height;
+    planar.resize(c_count * w_count);
+    interleaved.resize(c_count * w_count);
+    for (size_t r = first; r < last; ++r) {
+        size_t n = r / h_count, y = r % h_count;
+        if (job.to_nhwc) {
+            for (size_t c = 0; c < c_count; ++c) {
+                size_t offset = ((n * c_count + c) * h_count + y) * w_count;
+                job.to(job.src + offset * job.src_element, w_count, job.src_params, planar.data() + c * w_count);
+            }
+            for (size_t x = 0; x < w_count; ++x) {
+                for (size_t c = 0; c < c_count; ++c) {
+                    interleaved[x * c_count + c] = planar[c * w_count + x];
+                }
+            }
+            size_t offset = (n * h_count + y) * w_count * c_count;
+            job.from(interleaved.data(), w_count * c_count, job.dst_params, job.dst + offset * job.dst_element);
+        } else {
+            size_t offset = (n * h_count + y) * w_count * c_count;
+            job.to(job.src + offset * job.src_element, w_count * c_count, job.src_params, interleaved.data());
+            for (size_t c = 0; c < c_count; ++c) {
+                for (size_t x = 0; x < w_count; ++x) {
+                    planar[c * w_count + x] = interleaved[x * c_count + c];
+                }
+            }
+            for (size_t c = 0; c < c_count; ++c) {
+                size_t plane_offset = ((n * c_count + c) * h_count + y) * w_count;
+                job.from(planar.data() + c * w_count, w_count, job.dst_params, job.dst + plane_offset * job.dst_element);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+IEStatusCode ie_blob_convert(const ie_blob_t *src_blob, ie_blob_t *dst_blob) {
+    return ie_blob_convert_quantized(src_blob, nullptr, dst_blob, nullptr);
+}
+
+IEStatusCode ie_blob_convert_quantized(const ie_blob_t *src_blob, const ie_quantization_t *src_quantization, \
+        ie_blob_t *dst_blob, const ie_quantization_t *dst_quantization) {
+    if (src_blob == nullptr || dst_blob == nullptr || src_blob == dst_blob ||
+        (src_quantization && !(src_quantization->scale != 0.0f)) || (dst_quantization && !(dst_quantization->scale != 0.0f))) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        const IE::TensorDesc &src_desc = src_blob->object->getTensorDesc();
+        const IE::TensorDesc &dst_desc = dst_blob->object->getTensorDesc();
+        if (src_desc.getDims() != dst_desc.getDims()) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        IE::Layout src_layout = src_desc.getLayout();
+        IE::Layout dst_layout = dst_desc.getLayout();
+        bool transpose = src_layout != dst_layout;
+        bool nchw_nhwc = (src_layout == IE::Layout::NCHW && dst_layout == IE::Layout::NHWC) ||
+            (src_layout == IE::Layout::NHWC && dst_layout == IE::Layout::NCHW);
+        convert_job job = {};
+        job.to = toFloat(src_desc.getPrecision());
+        job.from = fromFloat(dst_desc.getPrecision());
+        if (job.to == nullptr || job.from == nullptr || (transpose && !nchw_nhwc) || !denseBlob(src_desc) ||
+            !denseBlob(dst_desc)) {
+            return IEStatusCode::NOT_IMPLEMENTED;
+        }
+
+        job.src = src_blob->object->cbuffer().as<const uint8_t *>();
+        job.dst = dst_blob->object->buffer().as<uint8_t *>();
+        if (job.src == nullptr || job.dst == nullptr) {
+            return IEStatusCode::NOT_ALLOCATED;
+        }
+        job.src_element = src_desc.getPrecision().size();
+        job.dst_element = dst_desc.getPrecision().size();
+        job.src_params = convertParams(src_quantization);
+        job.dst_params = convertParams(dst_quantization);
+        job.transpose = transpose;
+        job.to_nhwc = dst_layout == IE::Layout::NHWC;
+        size_t elements = src_blob->object->size();
+        if (transpose) {
+            const IE::SizeVector &dims = src_desc.getDims();
+            job.channels = dims[1];
+            job.height = dims[2];
+            job.width = dims[3];
+            job.rows = dims[0] * dims[2];
+        } else {
+            job.rows = (elements + convert_chunk - 1) / convert_chunk;
+            job.row_elements = convert_chunk;
+        }
+        if (elements == 0) {
+            return IEStatusCode::OK;
+        }
+
+        // small tensors are converted on the calling thread, large ones are split in rows between threads
+        const size_t min_elements_per_thread = 1 << 18;
+        size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), elements / min_elements_per_thread);
+        threads = std::max<size_t>(1, std::min(threads, job.rows));
+        size_t last_row = job.rows;
+        if (!transpose && elements % convert_chunk) {
+            // the partial last run is converted on its own
+            --last_row;
+            size_t done = last_row * convert_chunk;
+            float chunk[convert_chunk];
+            convertRun(job, job.src + done * job.src_element, job.dst + done * job.dst_element, elements - done, chunk);
+        }
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < threads; ++t) {
+            workers.emplace_back(convertRows, std::cref(job), last_row * t / threads, last_row * (t + 1) / threads);
+        }
+        convertRows(job, 0, last_row / threads);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_get_memory_stats(ie_memory_stats_t *stats, ie_memory_site_stats_t *sites, size_t *num_sites) {
+    if (stats == nullptr || (sites != nullptr && num_sites == nullptr)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    // sum the shards, a count of one shard may be negative when its objects were freed by other threads
+    int64_t objects[MEM_KINDS] = {}, wrapper_bytes = 0, data[MEM_DATAS] = {};
+    int64_t allocations[SITES] = {}, frees[SITES] = {}, live_bytes[SITES] = {};
+    {
+        mem_shards &shards = memShards();
+        std::lock_guard<std::mutex> lock(shards.mutex);
+        for (const mem_shard *shard : shards.all) {
+            for (size_t i = 0; i < MEM_KINDS; ++i) {
+                objects[i] += shard->objects[i].load(std::memory_order_relaxed);
+            }
+            wrapper_bytes += shard->wrapper_bytes.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < MEM_DATAS; ++i) {
+                data[i] += shard->data[i].load(std::memory_order_relaxed);
+            }
+            for (size_t i = 0; i < SITES; ++i) {
+                allocations[i] += shard->allocations[i].load(std::memory_order_relaxed);
+                frees[i] += shard->frees[i].load(std::memory_order_relaxed);
+                live_bytes[i] += shard->live_bytes[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    // shards are read one by one while other threads count, a sum may be briefly negative
+    auto total = [](int64_t value) { return value > 0 ? static_cast<size_t>(value) : 0; };
+
+    stats->num_cores = total(objects[MEM_CORE]);
+    stats->num_networks = total(objects[MEM_NETWORK]);
+    stats->num_executable_networks = total(objects[MEM_EXECUTABLE]);
+    stats->num_infer_requests = total(objects[MEM_REQUEST]);
+    stats->num_blobs = total(objects[MEM_BLOB]);
+    stats->wrapper_bytes = total(wrapper_bytes);
+    stats->blob_bytes = total(data[MEM_DATA_BLOB]);
+    stats->request_blob_bytes = total(data[MEM_DATA_REQUEST_BLOBS]);
+    stats->network_bytes = total(data[MEM_DATA_LOAD]);
+
+    if (num_sites) {
+        size_t capacity = sites ? *num_sites : 0;
+        for (size_t i = 0; i < capacity && i < SITES; ++i) {
+            sites[i].site = memSiteName(static_cast<mem_site>(i));
+            sites[i].allocations = total(allocations[i]);
+            sites[i].frees = total(frees[i]);
+            sites[i].live_bytes = total(live_bytes[i]);
+        }
+        *num_sites = SITES;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_exec_network_get_memory_stats(const ie_executable_network_t *ie_exec_network, ie_exec_memory_stats_t *stats) {
+    if (ie_exec_network == nullptr || stats == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    stats->network_bytes = ie_exec_network->mem.data_bytes;
+    stats->num_infer_requests = ie_exec_network->memory->num_requests.load(std::memory_order_relaxed);
+    stats->request_blob_bytes = ie_exec_network->memory->request_blob_bytes.load(std::memory_order_relaxed);
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_exec_network_get_port_memory(const ie_executable_network_t *ie_exec_network, const char *port_name, size_t *bytes) {
+    if (ie_exec_network == nullptr || port_name == nullptr || bytes == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    exec_memory &exec_mem = *ie_exec_network->memory;
+    std::lock_guard<std::mutex> lock(exec_mem.mutex);
+    auto it = exec_mem.port_bytes.find(port_name);
+    if (it == exec_mem.port_bytes.end()) {
+        return IEStatusCode::NOT_FOUND;
+    }
+    *bytes = it->second * exec_mem.num_requests.load(std::memory_order_relaxed);
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_trace_start(size_t events_per_thread) {
+    std::lock_guard<std::mutex> lock(tracer.mutex);
+    if (tracer.enabled.load(std::memory_order_relaxed)) {
+        return IEStatusCode::REQUEST_BUSY;
+    }
+
+    // buffers only referenced by the registry belong to threads which have exited
+    tracer.buffers.erase(std::remove_if(tracer.buffers.begin(), tracer.buffers.end(),
+        [](const std::shared_ptr<trace_buffer> &buffer) { return buffer.use_count() == 1; }), tracer.buffers.end());
+    tracer.capacity = events_per_thread ? events_per_thread : 65536;
+    tracer.origin_ns = traceNow();
+    tracer.session.fetch_add(1, std::memory_order_release);
+    tracer.enabled.store(true, std::memory_order_release);
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_trace_stop(const char *path) {
+    std::lock_guard<std::mutex> lock(tracer.mutex);
+    if (!tracer.enabled.load(std::memory_order_relaxed)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    tracer.enabled.store(false, std::memory_order_release);
+    if (path == nullptr) {
+        return IEStatusCode::OK;
+    }
+
+    FILE *file = fopen(path, "w");
+    if (file == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+#ifdef __linux__
+    long pid = static_cast<long>(getpid());
+#else
+    long pid = 0;
+#endif
+    uint64_t session = tracer.session.load(std::memory_order_relaxed);
+    size_t dropped = 0;
+    bool first = true;
+    fprintf(file, "{\"traceEvents\":[");
+    for (const auto &buffer : tracer.buffers) {
+        if (buffer->session.load(std::memory_order_acquire) != session) {
+            continue;
+        }
+        size_t count = buffer->count.load(std::memory_order_acquire);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            const trace_event &event = buffer->events[i];
+            if (event.begin_ns < tracer.origin_ns) {
+                continue;
+            }
+            fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"ie_c_api\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                    "\"pid\":%ld,\"tid\":%llu,\"args\":{\"request\":%llu}}", first ? "" : ",", event.name,
+                    (event.begin_ns - tracer.origin_ns) * 1e-3, (event.end_ns - event.begin_ns) * 1e-3, pid,
+                    static_cast<unsigned long long>(buffer->tid), static_cast<unsigned long long>(event.request_id));
+            first = false;
+        }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%llu}}\n",
+            static_cast<unsigned long long>(dropped));
+    bool ok = ferror(file) == 0;
+    ok = fclose(file) == 0 && ok;
+
+    return ok ? IEStatusCode::OK : IEStatusCode::GENERAL_ERROR;
+}
+
+IEStatusCode ie_capture_create(const ie_capture_config_t *config, ie_capture_t **capture) {
+    if (config == nullptr || config->path == nullptr || capture == nullptr ||
+        !(config->sample_rate > 0.0 && config->sample_rate <= 1.0)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::shared_ptr<capture_log> log = std::make_shared<capture_log>();
+        log->file = fopen(config->path, "wb");
+        if (log->file == nullptr) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        log->sample_rate = config->sample_rate;
+        log->max_bytes = config->max_bytes;
+
+        ie_capture_file_header_t header = {};
+        memcpy(header.magic, IE_CAPTURE_MAGIC, sizeof(header.magic));
+        header.version = IE_CAPTURE_VERSION;
+        header.header_size = sizeof(header);
+        header.created_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        if (fwrite(&header, sizeof(header), 1, log->file) != 1) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        log->bytes = sizeof(header);
+        log->origin = std::chrono::steady_clock::now();
+
+        std::unique_ptr<ie_capture_t> result(new ie_capture_t);
+        result->log = log;
+        *capture = result.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_capture_free(ie_capture_t **capture) {
+    if (capture) {
+        delete *capture;
+        *capture = NULL;
+    }
+}
+
+IEStatusCode ie_capture_get_stats(ie_capture_t *capture, ie_capture_stats_t *stats) {
+    if (capture == nullptr || stats == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    capture_log &log = *capture->log;
+    std::lock_guard<std::mutex> lock(log.mutex);
+    if (fflush(log.file) != 0) {
+        log.failed = true;
+    }
+    stats->submits = log.submits;
+    stats->recorded = log.recorded;
+    stats->dropped = log.dropped;
+    stats->bytes = log.bytes;
+
+    return log.failed || ferror(log.file) ? IEStatusCode::GENERAL_ERROR : IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_set_capture(ie_infer_request_t *infer_request, ie_capture_t *capture) {
+    if (infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    infer_request->capture = capture ? capture->log : nullptr;
+    infer_request->capture_inputs.clear();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_result_cache_create(ie_executable_network_t *exe_network, const ie_result_cache_config_t *config, \
+        ie_result_cache_t **cache) {
+    if (exe_network == nullptr || config == nullptr || config->capacity == 0 || config->ttl_ms < 0 || cache == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::shared_ptr<result_cache_state> state = std::make_shared<result_cache_state>();
+        state->capacity = config->capacity;
+        state->ttl = std::chrono::milliseconds(config->ttl_ms);
+        for (const auto &input : exe_network->object.GetInputsInfo()) {
+            state->inputs.push_back(input.first);
+        }
+        for (const auto &output : exe_network->object.GetOutputsInfo()) {
+            state->outputs.push_back(output.first);
+        }
+
+        std::unique_ptr<ie_result_cache_t> result(new ie_result_cache_t);
+        result->state = state;
+        *cache = result.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_result_cache_free(ie_result_cache_t **cache) {
+    if (cache) {
+        delete *cache;
+        *cache = NULL;
+    }
+}
+
+IEStatusCode ie_result_cache_clear(ie_result_cache_t *cache) {
+    if (cache == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    result_cache_state &state = *cache->state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.entries.clear();
+    state.index.clear();
+    state.bytes = 0;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_result_cache_get_stats(ie_result_cache_t *cache, ie_result_cache_stats_t *stats) {
+    if (cache == nullptr || stats == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    result_cache_state &state = *cache->state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    stats->lookups = state.lookups;
+    stats->hits = state.hits;
+    stats->misses = state.misses;
+    stats->insertions = state.insertions;
+    stats->evictions = state.evictions;
+    stats->expirations = state.expirations;
+    stats->bypassed = state.bypassed;
+    stats->entries = state.entries.size();
+    stats->bytes = state.bytes;
+    stats->hit_rate = state.lookups ? static_cast<double>(state.hits) / state.lookups : 0.0;
+    stats->hash_ms = state.hash_ms;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_set_result_cache(ie_infer_request_t *infer_request, ie_result_cache_t *cache) {
+    if (infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->result_cache = cache ? cache->state : nullptr;
+        infer_request->served = false;
+        infer_request->cache_pending = false;
+        installCompletion(infer_request);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_frame_gate_create(ie_executable_network_t *exe_network, const ie_frame_gate_config_t *config, \
+        ie_frame_gate_t **gate) {
+    if (exe_network == nullptr || config == nullptr || config->threshold < 0.0 || gate == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        IE::ConstInputsDataMap inputs = exe_network->object.GetInputsInfo();
+        IE::ConstInputsDataMap::iterator input = config->input_name ? inputs.find(config->input_name) : inputs.begin();
+        if (input == inputs.end()) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        IE::Precision precision = input->second->getTensorDesc().getPrecision();
+        if (!(precision == IE::Precision::U8 || precision == IE::Precision::FP32)) {
+            return IEStatusCode::NOT_IMPLEMENTED;
+        }
+
+        std::shared_ptr<frame_gate_state> state = std::make_shared<frame_gate_state>();
+        state->input = input->first;
+        for (const auto &output : exe_network->object.GetOutputsInfo()) {
+            state->outputs.push_back(output.first);
+        }
+        state->metric = config->metric;
+        state->downsample = config->downsample ? config->downsample : 1;
+        state->threshold = config->threshold;
+        state->max_skip = config->max_skip;
+
+        std::unique_ptr<ie_frame_gate_t> result(new ie_frame_gate_t);
+        result->state = state;
+        *gate = result.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_frame_gate_free(ie_frame_gate_t **gate) {
+    if (gate) {
+        delete *gate;
+        *gate = NULL;
+    }
+}
+
+IEStatusCode ie_frame_gate_reset(ie_frame_gate_t *gate) {
+    if (gate == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    frame_gate_state &state = *gate->state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.has_reference = false;
+    state.outputs_ready = false;
+    state.reference.clear();
+    state.reference_outputs.clear();
+    state.skipped_in_row = 0;
+    ++state.sequence;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_frame_gate_get_stats(ie_frame_gate_t *gate, ie_frame_gate_stats_t *stats) {
+    if (gate == nullptr || stats == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    frame_gate_state &state = *gate->state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    stats->frames = state.frames;
+    stats->inferred = state.inferred;
+    stats->skipped = state.skipped;
+    stats->forced = state.forced;
+    stats->bypassed = state.bypassed;
+    stats->skip_rate = state.frames ? static_cast<double>(state.skipped) / state.frames : 0.0;
+    stats->last_diff = state.last_diff;
+    stats->mean_diff = state.compared ? state.diff_sum / state.compared : 0.0;
+    stats->diff_ms = state.diff_ms;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_set_frame_gate(ie_infer_request_t *infer_request, ie_frame_gate_t *gate) {
+    if (infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->frame_gate = gate ? gate->state : nullptr;
+        infer_request->served = false;
+        infer_request->gate_pending = false;
+        installCompletion(infer_request);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status2IEStatus(e.getStatus()) : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
@@ -0,0 +1,215 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_c_api_internal.h
+ * Helpers shared by the sources of the C API wrapper, not installed with the public header.
+ */
+
+#ifndef IE_C_API_INTERNAL_H
+#define IE_C_API_INTERNAL_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <condition_variable>
+#include "ie_c_api.h"
+
+// kernels for x86 instruction set extensions are compiled with target attributes and selected at runtime
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define IE_C_API_X86_DISPATCH
+#endif
+
+/**
+ *@brief copy of an ie_config_t list owning its strings, for objects loading networks after the call that got the list.
+ * Not copyable, the list points into the strings.
+ */
+struct owned_config {
+    std::vector<std::pair<std::string, std::string>> pairs;
+    std::vector<ie_config_t> nodes{ie_config_t{NULL, NULL, NULL}};
+
+    owned_config() = default;
+    owned_config(const owned_config &) = delete;
+    owned_config &operator=(const owned_config &) = delete;
+
+    void assign(const ie_config_t *config) {
+        pairs.clear();
+        for (const ie_config_t *tmp = config; tmp && tmp->name && tmp->value; tmp = tmp->next) {
+            pairs.emplace_back(tmp->name, tmp->value);
+        }
+        relink();
+    }
+
+    bool contains(const std::string &name) const {
+        for (const auto &kv : pairs) {
+            if (kv.first == name) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void add(const std::string &name, const std::string &value) {
+        pairs.emplace_back(name, value);
+        relink();
+    }
+
+    const ie_config_t *list() const {
+        return nodes.data();
+    }
+
+private:
+    void relink() {
+        nodes.assign(pairs.size() + 1, ie_config_t{NULL, NULL, NULL});
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            nodes[i].name = pairs[i].first.c_str();
+            nodes[i].value = pairs[i].second.c_str();
+            nodes[i].next = &nodes[i + 1];
+        }
+    }
+};
+
+struct request_pool;
+
+/**
+ * @struct pooled_request
+ * @brief An infer request of a request_pool, with whether an inference of it is in flight or not yet waited for.
+ * Users keep their own state per request in a struct deriving from it.
+ */
+struct pooled_request {
+    ie_infer_request_t *request = nullptr;
+    ie_complete_call_back_t callback;
+    request_pool *pool = nullptr;
+    bool pending = false;
+};
+
+/**
+ * @struct request_pool
+ * @brief Infer requests of one executable network handed out one at a time, and back to idle from their completion
+ * callback. on_complete runs in the callback first, outside the lock, so the callbacks of several requests run at once.
+ */
+struct request_pool {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<pooled_request>> slots;
+    std::vector<pooled_request *> idle;
+    void (*on_complete)(pooled_request &slot) = nullptr;
+
+    request_pool() = default;
+    request_pool(const request_pool &) = delete;
+    request_pool &operator=(const request_pool &) = delete;
+    ~request_pool();
+
+    /**
+     *@brief creates the infer request of the slot and adds the slot as idle. The slot is dropped if the request
+     * could not be created.
+     */
+    IEStatusCode add(ie_executable_network_t *exe_network, std::unique_ptr<pooled_request> slot);
+
+    /**
+     *@brief waits for an idle slot and takes it.
+     */
+    pooled_request *acquire();
+
+    /**
+     *@brief gives a taken slot back without starting an inference.
+     */
+    void release(pooled_request *slot);
+
+    /**
+     *@brief starts an inference of a taken slot. The slot is idle again once it completes, or at once if it could
+     * not start.
+     */
+    IEStatusCode start(pooled_request *slot);
+
+    /**
+     *@brief waits until every slot is idle, and returns how many of the inferences not yet waited for failed.
+     */
+    size_t waitIdle();
+};
+
+/**
+ *@brief the status of the last inference of the slot, once it has completed.
+ */
+bool succeeded(pooled_request &slot);
+
+/**
+ *@brief status of the last asynchronous submit of the request, OK for a submit served without inference.
+ * Valid in the completion callback of the request.
+ */
+IEStatusCode inferRequestStatus(const ie_infer_request_t *infer_request);
+
+/**
+ *@brief resident set size of the process, 0 if unknown.
+ */
+size_t residentBytes();
+
+/**
+ *@brief FP16 to FP32, exact. NaNs come out quiet, as from F16C. The reference of the F16C kernels.
+ */
+inline float halfToFloat(uint16_t h) {
+    uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1f;
+    uint32_t mantissa = h & 0x3ff;
+    uint32_t bits;
+    if (exponent == 0x1f) {
+        bits = sign | 0x7f800000 | (mantissa << 13) | (mantissa ? 0x400000 : 0);
+    } else if (exponent) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa) {
+        // subnormal, normalized for FP32
+        exponent = 113;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+    } else {
+        bits = sign;
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ *@brief FP32 to FP16 rounding to nearest even, with overflow to infinity and gradual underflow, as F16C does.
+ */
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    uint32_t magnitude = bits & 0x7fffffff;
+    if (magnitude >= 0x7f800000) {
+        return sign | 0x7c00 | (magnitude > 0x7f800000 ? 0x200 | ((magnitude >> 13) & 0x3ff) : 0);
+    }
+    if (magnitude >= 0x477ff000) {
+        // rounds to more than the largest FP16
+        return sign | 0x7c00;
+    }
+    if (magnitude < 0x38800000) {
+        // subnormal FP16, the implicit bit is shifted into the mantissa
+        if (magnitude < 0x33000000) {
+            return sign;
+        }
+        uint32_t exponent = magnitude >> 23;
+        uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+        uint32_t shift = 126 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        half += rest > halfway || (rest == halfway && (half & 1));
+        return sign | static_cast<uint16_t>(half);
+    }
+    uint32_t half = ((magnitude >> 13) - (112 << 10));
+    uint32_t rest = magnitude & 0x1fff;
+    half += rest > 0x1000 || (rest == 0x1000 && (half & 1));
+    return sign | static_cast<uint16_t>(half);
+}
+
+#endif  // IE_C_API_INTERNAL_H
@@ -0,0 +1,367 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+typedef std::chrono::steady_clock clock_type;
+
+struct registry_model {
+    std::string xml;
+    std::string bin;
+    std::string cache_file;
+    ie_executable_network_t *exe_network = nullptr;
+    size_t users = 0;
+    bool loading = false;
+    bool exportable = true;
+    unsigned long long last_used = 0;
+    size_t memory = 0;
+    size_t requests = 0;
+    size_t hits = 0;
+    size_t loads = 0;
+    size_t imports = 0;
+    size_t evictions = 0;
+    double last_load_ms = 0.0;
+    double total_load_ms = 0.0;
+};
+
+size_t fileSize(const std::string &path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return file ? static_cast<size_t>(file.tellg()) : 0;
+}
+
+}  // namespace
+
+/**
+ * @struct ie_model_registry
+ * @brief Lazily loaded executable networks of many models sharing one core and one memory budget.
+ */
+struct ie_model_registry {
+    ie_core_t *core = nullptr;
+    std::string device_name;
+    owned_config config;
+    size_t memory_budget = 0;
+    std::string cache_dir;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    // loads are serialized so that the growth of the resident set can be accounted to one network
+    std::mutex load_mutex;
+    std::map<std::string, registry_model> models;
+    size_t used = 0;
+    unsigned long long tick = 0;
+};
+
+namespace {
+
+/**
+ *@brief evicts the least recently used idle networks until `needed` more bytes fit the budget.
+ * Evicted networks are returned to be freed outside of the registry lock.
+ */
+void evictIdle(ie_model_registry *registry, size_t needed, std::vector<ie_executable_network_t *> &evicted) {
+    if (registry->memory_budget == 0) {
+        return;
+    }
+    while (registry->used + needed > registry->memory_budget) {
+        registry_model *lru = nullptr;
+        for (auto &it : registry->models) {
+            registry_model &model = it.second;
+            if (model.exe_network && model.users == 0 && !model.loading && (lru == nullptr || model.last_used < lru->last_used)) {
+                lru = &model;
+            }
+        }
+        if (lru == nullptr) {
+            // everything left is in use, the budget is exceeded until networks are released
+            return;
+        }
+        evicted.push_back(lru->exe_network);
+        lru->exe_network = nullptr;
+        registry->used -= lru->memory;
+        ++lru->evictions;
+    }
+}
+
+void freeNetworks(std::vector<ie_executable_network_t *> &networks) {
+    for (auto &exe_network : networks) {
+        ie_exec_network_free(&exe_network);
+    }
+    networks.clear();
+}
+
+IEStatusCode loadModel(ie_model_registry *registry, const registry_model &model, bool *exportable, ie_executable_network_t **exe_network,
+        bool *imported) {
+    *imported = false;
+    if (!model.cache_file.empty() && fileSize(model.cache_file) != 0) {
+        if (ie_core_import_network(registry->core, model.cache_file.c_str(), registry->device_name.c_str(),
+                registry->config.list(), exe_network) == IEStatusCode::OK) {
+            *imported = true;
+            return IEStatusCode::OK;
+        }
+        // stale or foreign blob, rebuild it from the IR
+        std::remove(model.cache_file.c_str());
+    }
+
+    ie_network_t *network = nullptr;
+    IEStatusCode status = ie_core_read_network(registry->core, model.xml.c_str(), model.bin.c_str(), &network);
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+    status = ie_core_load_network(registry->core, network, registry->device_name.c_str(), registry->config.list(), exe_network);
+    ie_network_free(&network);
+    if (status == IEStatusCode::OK && *exportable && !model.cache_file.empty()) {
+        if (ie_exec_network_export(*exe_network, model.cache_file.c_str()) != IEStatusCode::OK) {
+            // the device does not support export, do not try again
+            std::remove(model.cache_file.c_str());
+            *exportable = false;
+        }
+    }
+    return status;
+}
+
+}  // namespace
+
+IEStatusCode ie_model_registry_create(ie_core_t *core, const ie_model_registry_config_t *config, ie_model_registry_t **registry) {
+    if (core == nullptr || config == nullptr || config->device_name == nullptr || registry == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_model_registry_t> reg(new ie_model_registry_t);
+        reg->core = core;
+        reg->device_name = config->device_name;
+        reg->memory_budget = config->memory_budget;
+        if (config->cache_dir != nullptr) {
+            reg->cache_dir = config->cache_dir;
+        }
+        reg->config.assign(config->config);
+        *registry = reg.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_model_registry_free(ie_model_registry_t **registry) {
+    if (registry == nullptr || *registry == nullptr) {
+        return;
+    }
+
+    ie_model_registry_t *reg = *registry;
+    std::vector<ie_executable_network_t *> networks;
+    {
+        std::unique_lock<std::mutex> lock(reg->mutex);
+        reg->cv.wait(lock, [reg] {
+            for (const auto &it : reg->models) {
+                if (it.second.loading) {
+                    return false;
+                }
+            }
+            return true;
+        });
+        for (auto &it : reg->models) {
+            if (it.second.exe_network) {
+                networks.push_back(it.second.exe_network);
+            }
+        }
+    }
+    freeNetworks(networks);
+    delete reg;
+    *registry = NULL;
+}
+
+IEStatusCode ie_model_registry_add_model(ie_model_registry_t *registry, const char *model_id, const char *xml, const char *weights_file) {
+    if (registry == nullptr || model_id == nullptr || xml == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        registry_model model;
+        model.xml = xml;
+        if (weights_file != nullptr) {
+            model.bin = weights_file;
+        } else {
+            size_t dot = model.xml.rfind('.');
+            model.bin = model.xml.substr(0, dot) + ".bin";
+        }
+        if (!registry->cache_dir.empty()) {
+            // the blob depends on the device and its configuration as much as on the model
+            std::stringstream key;
+            key << model_id << '\n' << model.xml << '\n' << registry->device_name;
+            for (const auto &kv : registry->config.pairs) {
+                key << '\n' << kv.first << '=' << kv.second;
+            }
+            std::string name;
+            for (const char *c = model_id; *c; ++c) {
+                bool safe = (*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') || *c == '-' || *c == '_';
+                name += safe ? *c : '_';
+            }
+            std::stringstream file;
+            file << registry->cache_dir << '/' << name << '_' << std::hex << std::hash<std::string>()(key.str()) << ".blob";
+            model.cache_file = file.str();
+        }
+
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        if (!registry->models.emplace(model_id, std::move(model)).second) {
+            return IEStatusCode::PARAMETER_MISMATCH;
+        }
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_model_registry_acquire(ie_model_registry_t *registry, const char *model_id, ie_executable_network_t **exe_network) {
+    if (registry == nullptr || model_id == nullptr || exe_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::vector<ie_executable_network_t *> evicted;
+        std::unique_lock<std::mutex> lock(registry->mutex);
+        auto it = registry->models.find(model_id);
+        if (it == registry->models.end()) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        registry_model &model = it->second;
+        ++model.requests;
+        registry->cv.wait(lock, [&model] { return !model.loading; });
+
+        if (model.exe_network) {
+            ++model.hits;
+            ++model.users;
+            model.last_used = ++registry->tick;
+            *exe_network = model.exe_network;
+            return IEStatusCode::OK;
+        }
+
+        // make room with the size measured on the previous load, the weights size before the first one
+        model.loading = true;
+        evictIdle(registry, model.memory ? model.memory : fileSize(model.bin), evicted);
+        bool exportable = model.exportable;
+        lock.unlock();
+        freeNetworks(evicted);
+
+        ie_executable_network_t *loaded = nullptr;
+        bool imported = false;
+        IEStatusCode status;
+        size_t memory;
+        double load_ms;
+        {
+            std::lock_guard<std::mutex> load_lock(registry->load_mutex);
+            size_t rss_before = residentBytes();
+            auto begin = clock_type::now();
+            status = loadModel(registry, model, &exportable, &loaded, &imported);
+            load_ms = std::chrono::duration<double, std::milli>(clock_type::now() - begin).count();
+            size_t rss_after = residentBytes();
+            // the growth undercounts when the load reuses heap freed by the evictions, the weights are a lower bound
+            memory = std::max(rss_after > rss_before ? rss_after - rss_before : 0, fileSize(model.bin));
+        }
+
+        lock.lock();
+        model.loading = false;
+        model.exportable = exportable;
+        if (status == IEStatusCode::OK) {
+            model.exe_network = loaded;
+            model.memory = memory;
+            model.users = 1;
+            model.last_used = ++registry->tick;
+            model.last_load_ms = load_ms;
+            model.total_load_ms += load_ms;
+            ++(imported ? model.imports : model.loads);
+            registry->used += memory;
+            evictIdle(registry, 0, evicted);
+            *exe_network = loaded;
+        }
+        // notify under the lock, ie_model_registry_free() may destroy the registry once nothing is loading.
+        registry->cv.notify_all();
+        lock.unlock();
+        freeNetworks(evicted);
+        return status;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+}
+
+IEStatusCode ie_model_registry_release(ie_model_registry_t *registry, const char *model_id) {
+    if (registry == nullptr || model_id == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::vector<ie_executable_network_t *> evicted;
+        {
+            std::lock_guard<std::mutex> lock(registry->mutex);
+            auto it = registry->models.find(model_id);
+            if (it == registry->models.end()) {
+                return IEStatusCode::NOT_FOUND;
+            }
+            if (it->second.users == 0) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            --it->second.users;
+            // a network loaded over budget is evicted as soon as something becomes idle
+            evictIdle(registry, 0, evicted);
+        }
+        freeNetworks(evicted);
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_model_registry_get_model_stats(ie_model_registry_t *registry, const char *model_id, ie_model_stats_t *stats) {
+    if (registry == nullptr || model_id == nullptr || stats == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    auto it = registry->models.find(model_id);
+    if (it == registry->models.end()) {
+        return IEStatusCode::NOT_FOUND;
+    }
+
+    const registry_model &model = it->second;
+    size_t num_loads = model.loads + model.imports;
+    stats->requests = model.requests;
+    stats->hits = model.hits;
+    stats->loads = model.loads;
+    stats->imports = model.imports;
+    stats->evictions = model.evictions;
+    stats->hit_rate = model.requests ? static_cast<double>(model.hits) / model.requests : 0.0;
+    stats->last_load_ms = model.last_load_ms;
+    stats->avg_load_ms = num_loads ? model.total_load_ms / num_loads : 0.0;
+    stats->memory_bytes = model.memory;
+    stats->resident = model.exe_network != nullptr;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_model_registry_get_memory_usage(ie_model_registry_t *registry, size_t *used_bytes) {
+    if (registry == nullptr || used_bytes == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    *used_bytes = registry->used;
+
+    return IEStatusCode::OK;
+}
@@ -0,0 +1,453 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <cstdlib>
+#include <condition_variable>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+#ifdef __linux__
+#include <sched.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
+
+namespace {
+
+struct numa_node {
+    int id;
+    std::vector<int> cpus;
+};
+
+/**
+ *@brief parse a kernel cpu or node list such as "0-3,8-11".
+ */
+std::vector<int> parseList(const std::string &list) {
+    std::vector<int> result;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int i = first; i <= last; ++i) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::vector<numa_node> discoverNodes() {
+    std::vector<numa_node> nodes;
+#ifdef __linux__
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+    if (online && std::getline(online, list)) {
+        for (int id : parseList(list)) {
+            std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist");
+            std::string cpus;
+            if (cpulist && std::getline(cpulist, cpus)) {
+                numa_node node = {id, parseList(cpus)};
+                if (!node.cpus.empty()) {
+                    nodes.push_back(node);
+                }
+            }
+        }
+    }
+#endif
+    if (nodes.empty()) {
+        nodes.push_back(numa_node{-1, {}});
+    }
+    return nodes;
+}
+
+#ifdef __linux__
+const unsigned long mask_bits = 8 * sizeof(unsigned long) * 16;
+
+void nodeMask(int node, unsigned long *mask) {
+    for (size_t i = 0; i < mask_bits / (8 * sizeof(unsigned long)); ++i) {
+        mask[i] = 0;
+    }
+    mask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+}
+
+/**
+ *@brief bind the calling thread to the CPUs and the memory of the node.
+ */
+void bindThread(const numa_node &node) {
+    if (node.id < 0 || node.id >= static_cast<int>(mask_bits)) {
+        return;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int cpu : node.cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpus);
+        }
+    }
+    sched_setaffinity(0, sizeof(cpus), &cpus);
+
+    unsigned long mask[mask_bits / (8 * sizeof(unsigned long))];
+    nodeMask(node.id, mask);
+    syscall(SYS_set_mempolicy, MPOL_BIND, mask, mask_bits);
+}
+
+/**
+ *@brief move the whole pages of the buffer to the node, the pages at the edges may be shared with other data.
+ */
+void bindMemory(const numa_node &node, void *ptr, size_t size) {
+    if (node.id < 0 || node.id >= static_cast<int>(mask_bits) || ptr == nullptr) {
+        return;
+    }
+    uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) & ~(page - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(page - 1);
+    if (end <= begin) {
+        return;
+    }
+
+    unsigned long mask[mask_bits / (8 * sizeof(unsigned long))];
+    nodeMask(node.id, mask);
+    syscall(SYS_mbind, reinterpret_cast<void *>(begin), end - begin, MPOL_BIND, mask, mask_bits, MPOL_MF_MOVE);
+}
+
+std::set<pid_t> threadIds() {
+    std::set<pid_t> ids;
+    DIR *dir = opendir("/proc/self/task");
+    if (dir == nullptr) {
+        return ids;
+    }
+    while (dirent *entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            ids.insert(static_cast<pid_t>(atoi(entry->d_name)));
+        }
+    }
+    closedir(dir);
+    return ids;
+}
+
+/**
+ *@brief whether the threads started since `before`, other than the calling one, exist and may only run on the CPUs
+ * of the node. Threads of a pool shared by the process, started before, cannot be told apart and give false.
+ */
+bool newThreadsBound(const std::set<pid_t> &before, const numa_node &node) {
+    if (node.id < 0) {
+        return false;
+    }
+    pid_t self = static_cast<pid_t>(syscall(SYS_gettid));
+    size_t checked = 0;
+    for (pid_t tid : threadIds()) {
+        if (before.count(tid) || tid == self) {
+            continue;
+        }
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        if (sched_getaffinity(tid, sizeof(cpus), &cpus) != 0) {
+            continue;  // exited meanwhile
+        }
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &cpus) && std::find(node.cpus.begin(), node.cpus.end(), cpu) == node.cpus.end()) {
+                return false;
+            }
+        }
+        ++checked;
+    }
+    return checked > 0;
+}
+
+int currentNode(const std::vector<int> &cpu_to_replica) {
+    int cpu = sched_getcpu();
+    if (cpu < 0 || cpu >= static_cast<int>(cpu_to_replica.size())) {
+        return 0;
+    }
+    return cpu_to_replica[cpu];
+}
+#else
+typedef int pid_t;
+void bindThread(const numa_node &) {}
+void bindMemory(const numa_node &, void *, size_t) {}
+std::set<pid_t> threadIds() { return std::set<pid_t>(); }
+bool newThreadsBound(const std::set<pid_t> &, const numa_node &) { return false; }
+int currentNode(const std::vector<int> &) { return 0; }
+#endif
+
+std::vector<std::string> portNames(const ie_network_t *network) {
+    std::vector<std::string> names;
+    size_t inputs = 0, outputs = 0;
+    if (ie_network_get_inputs_number(network, &inputs) != IEStatusCode::OK ||
+        ie_network_get_outputs_number(network, &outputs) != IEStatusCode::OK) {
+        return names;
+    }
+    for (size_t i = 0; i < inputs + outputs; ++i) {
+        char *name = nullptr;
+        IEStatusCode status = i < inputs ? ie_network_get_input_name(network, i, &name)
+                                         : ie_network_get_output_name(network, i - inputs, &name);
+        if (status == IEStatusCode::OK) {
+            names.push_back(name);
+            ie_network_name_free(&name);
+        }
+    }
+    return names;
+}
+
+}  // namespace
+
+/**
+ * @struct numa_replica
+ * @brief The executable network loaded on one node and its pool of infer requests.
+ */
+struct numa_replica {
+    numa_node node;
+    ie_executable_network_t *exe_network = nullptr;
+    std::vector<ie_infer_request_t *> requests;
+    std::vector<ie_infer_request_t *> idle;
+    bool bound = false;  // the threads started for the replica were found bound to its node
+};
+
+/**
+ * @struct ie_numa_network
+ * @brief Executable network replicated on every NUMA node.
+ */
+struct ie_numa_network {
+    std::vector<numa_replica> replicas;
+    std::vector<int> cpu_to_replica;
+    std::map<ie_infer_request_t *, size_t> owner;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+namespace {
+
+IEStatusCode loadReplica(ie_core_t *core, const ie_network_t *network, const char *device_name, const ie_config_t *config, \
+        size_t num_requests, numa_replica &replica) {
+    // the user's keys win over the defaults
+    owned_config conf;
+    conf.assign(config);
+    if (std::string(device_name).compare(0, 3, "CPU") == 0 && !replica.node.cpus.empty()) {
+        if (!conf.contains("CPU_THREADS_NUM")) {
+            conf.add("CPU_THREADS_NUM", std::to_string(replica.node.cpus.size()));
+        }
+        if (!conf.contains("CPU_BIND_THREAD")) {
+            conf.add("CPU_BIND_THREAD", "NO");
+        }
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    // threads created by the plugin while loading or on the first inference inherit the affinity of the loading
+    // thread. Threads of a pool shared by the process, such as the TBB or OpenMP workers, keep their own.
+    std::set<pid_t> before = threadIds();
+    std::thread loader([&] {
+        bindThread(replica.node);
+        status = ie_core_load_network(core, network, device_name, conf.list(), &replica.exe_network);
+        if (status != IEStatusCode::OK) {
+            return;
+        }
+
+        std::vector<std::string> ports = portNames(network);
+        for (size_t i = 0; i < num_requests && status == IEStatusCode::OK; ++i) {
+            ie_infer_request_t *request = nullptr;
+            status = ie_exec_network_create_infer_request(replica.exe_network, &request);
+            if (status != IEStatusCode::OK) {
+                break;
+            }
+            replica.requests.push_back(request);
+
+            for (const auto &port : ports) {
+                ie_blob_t *blob = nullptr;
+                if (ie_infer_request_get_blob(request, port.c_str(), &blob) != IEStatusCode::OK) {
+                    continue;
+                }
+                ie_blob_buffer_t buffer;
+                int size = 0;
+                if (ie_blob_get_buffer(blob, &buffer) == IEStatusCode::OK && ie_blob_byte_size(blob, &size) == IEStatusCode::OK) {
+                    bindMemory(replica.node, buffer.buffer, static_cast<size_t>(size));
+                }
+                ie_blob_free(&blob);
+            }
+        }
+        // the first inferences run from the bound thread, then the affinity of the threads they started is checked
+        if (status == IEStatusCode::OK) {
+            status = ie_exec_network_warmup(replica.exe_network, replica.requests.data(), replica.requests.size(), 1,
+                                            warmup_fill_e::WARMUP_FILL_ZEROS, NULL);
+        }
+        if (status == IEStatusCode::OK) {
+            replica.bound = newThreadsBound(before, replica.node);
+        }
+    });
+    loader.join();
+
+    replica.idle = replica.requests;
+    return status;
+}
+
+void freeReplica(numa_replica &replica) {
+    for (auto &request : replica.requests) {
+        ie_infer_request_free(&request);
+    }
+    replica.requests.clear();
+    replica.idle.clear();
+    ie_exec_network_free(&replica.exe_network);
+}
+
+}  // namespace
+
+IEStatusCode ie_core_load_network_numa(ie_core_t *core, const ie_network_t *network, const char *device_name, \
+        const ie_config_t *config, size_t requests_per_node, ie_numa_network_t **numa_network) {
+    if (core == nullptr || network == nullptr || device_name == nullptr || config == nullptr || numa_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_numa_network_t> numa_net(new ie_numa_network_t);
+        std::vector<numa_node> nodes = discoverNodes();
+        numa_net->replicas.resize(nodes.size());
+
+        for (size_t r = 0; r < nodes.size(); ++r) {
+            numa_replica &replica = numa_net->replicas[r];
+            replica.node = nodes[r];
+            for (int cpu : replica.node.cpus) {
+                if (cpu >= static_cast<int>(numa_net->cpu_to_replica.size())) {
+                    numa_net->cpu_to_replica.resize(cpu + 1, 0);
+                }
+                numa_net->cpu_to_replica[cpu] = static_cast<int>(r);
+            }
+
+            IEStatusCode status = loadReplica(core, network, device_name, config, std::max<size_t>(requests_per_node, 1), replica);
+            if (status != IEStatusCode::OK) {
+                for (auto &rep : numa_net->replicas) {
+                    freeReplica(rep);
+                }
+                return status;
+            }
+            for (auto request : replica.requests) {
+                numa_net->owner[request] = r;
+            }
+        }
+
+        *numa_network = numa_net.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_numa_network_free(ie_numa_network_t **numa_network) {
+    if (numa_network && *numa_network) {
+        for (auto &replica : (*numa_network)->replicas) {
+            freeReplica(replica);
+        }
+        delete *numa_network;
+        *numa_network = NULL;
+    }
+}
+
+IEStatusCode ie_numa_network_get_replicas_number(const ie_numa_network_t *numa_network, size_t *size_result) {
+    if (numa_network == nullptr || size_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    *size_result = numa_network->replicas.size();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_numa_network_get_replica(ie_numa_network_t *numa_network, size_t replica, ie_executable_network_t **ie_exec_network) {
+    if (numa_network == nullptr || ie_exec_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (replica >= numa_network->replicas.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    *ie_exec_network = numa_network->replicas[replica].exe_network;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_numa_network_acquire_request(ie_numa_network_t *numa_network, const int64_t timeout, \
+        ie_infer_request_t **request, size_t *replica) {
+    if (numa_network == nullptr || request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    size_t local = static_cast<size_t>(currentNode(numa_network->cpu_to_replica));
+    size_t count = numa_network->replicas.size();
+    size_t chosen = count;
+    auto pick = [&] {
+        // the local replica first, then the other nodes in order
+        for (size_t i = 0; i < count; ++i) {
+            size_t r = (local + i) % count;
+            if (!numa_network->replicas[r].idle.empty()) {
+                chosen = r;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::unique_lock<std::mutex> lock(numa_network->mutex);
+    if (timeout < 0) {
+        numa_network->cv.wait(lock, pick);
+    } else if (!numa_network->cv.wait_for(lock, std::chrono::milliseconds(timeout), pick)) {
+        return IEStatusCode::REQUEST_BUSY;
+    }
+
+    numa_replica &rep = numa_network->replicas[chosen];
+    *request = rep.idle.back();
+    rep.idle.pop_back();
+    if (replica) {
+        *replica = chosen;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_numa_network_release_request(ie_numa_network_t *numa_network, ie_infer_request_t *request) {
+    if (numa_network == nullptr || request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(numa_network->mutex);
+        auto it = numa_network->owner.find(request);
+        if (it == numa_network->owner.end()) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        numa_network->replicas[it->second].idle.push_back(request);
+    }
+    numa_network->cv.notify_one();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_numa_network_is_replica_bound(const ie_numa_network_t *numa_network, size_t replica, int *bound) {
+    if (numa_network == nullptr || bound == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (replica >= numa_network->replicas.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    *bound = numa_network->replicas[replica].bound ? 1 : 0;
+
+    return IEStatusCode::OK;
+}
@@ -0,0 +1,744 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+// Kernels. The AVX2 versions are selected at runtime and give the same results as the scalar ones.
+
+typedef size_t (*filter_scores_fn)(const float *scores, size_t count, float threshold, uint32_t *indices);
+typedef void (*center_size_fn)(const float *boxes, size_t num_boxes, float *corners);
+typedef bool (*overlaps_fn)(const float *x1, const float *y1, const float *x2, const float *y2, const float *area,
+                            size_t count, const float *box, float box_area, float threshold);
+
+size_t filterScoresScalar(const float *scores, size_t count, float threshold, uint32_t *indices) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (scores[i] >= threshold) {
+            indices[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+void centerSizeScalar(const float *boxes, size_t num_boxes, float *corners) {
+    for (size_t i = 0; i < num_boxes; ++i) {
+        const float *box = boxes + i * 4;
+        float half_w = 0.5f * box[2], half_h = 0.5f * box[3];
+        float *corner = corners + i * 4;
+        float cx = box[0], cy = box[1];
+        corner[0] = cx - half_w;
+        corner[1] = cy - half_h;
+        corner[2] = cx + half_w;
+        corner[3] = cy + half_h;
+    }
+}
+
+/**
+ *@brief whether the box overlaps any of the kept boxes, given as arrays, by more than the threshold.
+ * The IoU test is inter > threshold * union, which needs no division.
+ */
+bool overlapsScalar(const float *x1, const float *y1, const float *x2, const float *y2, const float *area,
+                    size_t count, const float *box, float box_area, float threshold) {
+    for (size_t i = 0; i < count; ++i) {
+        float w = std::max(0.0f, std::min(x2[i], box[2]) - std::max(x1[i], box[0]));
+        float h = std::max(0.0f, std::min(y2[i], box[3]) - std::max(y1[i], box[1]));
+        float inter = w * h;
+        if (inter > threshold * (area[i] + box_area - inter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef IE_C_API_X86_DISPATCH
+__attribute__((target("avx2"))) size_t filterScoresAvx2(const float *scores, size_t count, float threshold, uint32_t *indices) {
+    const __m256 limit = _mm256_set1_ps(threshold);
+    size_t n = 0;
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(scores + i), limit, _CMP_GE_OQ));
+        // most scores are below the threshold, whole vectors are skipped with one test
+        while (mask) {
+            int bit = __builtin_ctz(static_cast<unsigned>(mask));
+            indices[n++] = static_cast<uint32_t>(i + bit);
+            mask &= mask - 1;
+        }
+    }
+    for (; i < count; ++i) {
+        if (scores[i] >= threshold) {
+            indices[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+__attribute__((target("avx2"))) void centerSizeAvx2(const float *boxes, size_t num_boxes, float *corners) {
+    const __m256 half = _mm256_set1_ps(0.5f);
+    size_t i = 0;
+    for (; num_boxes - i >= 2; i += 2) {
+        // two boxes cx, cy, w, h per vector
+        __m256 box = _mm256_loadu_ps(boxes + i * 4);
+        __m256 center = _mm256_permute_ps(box, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 size = _mm256_mul_ps(_mm256_permute_ps(box, _MM_SHUFFLE(3, 2, 3, 2)), half);
+        __m256 low = _mm256_sub_ps(center, size);
+        __m256 high = _mm256_add_ps(center, size);
+        _mm256_storeu_ps(corners + i * 4, _mm256_blend_ps(low, high, 0xCC));
+    }
+    centerSizeScalar(boxes + i * 4, num_boxes - i, corners + i * 4);
+}
+
+__attribute__((target("avx2"))) bool overlapsAvx2(const float *x1, const float *y1, const float *x2, const float *y2,
+                                                   const float *area, size_t count, const float *box, float box_area,
+                                                   float threshold) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 bx1 = _mm256_set1_ps(box[0]), by1 = _mm256_set1_ps(box[1]);
+    const __m256 bx2 = _mm256_set1_ps(box[2]), by2 = _mm256_set1_ps(box[3]);
+    const __m256 barea = _mm256_set1_ps(box_area), limit = _mm256_set1_ps(threshold);
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        __m256 w = _mm256_max_ps(zero, _mm256_sub_ps(_mm256_min_ps(_mm256_loadu_ps(x2 + i), bx2),
+                                                     _mm256_max_ps(_mm256_loadu_ps(x1 + i), bx1)));
+        __m256 h = _mm256_max_ps(zero, _mm256_sub_ps(_mm256_min_ps(_mm256_loadu_ps(y2 + i), by2),
+                                                     _mm256_max_ps(_mm256_loadu_ps(y1 + i), by1)));
+        __m256 inter = _mm256_mul_ps(w, h);
+        __m256 uni = _mm256_sub_ps(_mm256_add_ps(_mm256_loadu_ps(area + i), barea), inter);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(inter, _mm256_mul_ps(limit, uni), _CMP_GT_OQ))) {
+            return true;
+        }
+    }
+    return overlapsScalar(x1 + i, y1 + i, x2 + i, y2 + i, area + i, count - i, box, box_area, threshold);
+}
+#endif
+
+struct postproc_kernels {
+    filter_scores_fn filter_scores;
+    center_size_fn center_size;
+    overlaps_fn overlaps;
+};
+
+const postproc_kernels &kernels() {
+    static const postproc_kernels selected = [] {
+#ifdef IE_C_API_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2")) {
+            return postproc_kernels{filterScoresAvx2, centerSizeAvx2, overlapsAvx2};
+        }
+#endif
+        return postproc_kernels{filterScoresScalar, centerSizeScalar, overlapsScalar};
+    }();
+    return selected;
+}
+
+/**
+ *@brief decodes SSD location deltas against prior boxes given by their corners, with the variances of the priors.
+ */
+void decodePrior(const float *delta, const float *prior, const float *variances, float *corner) {
+    float prior_w = prior[2] - prior[0], prior_h = prior[3] - prior[1];
+    float prior_cx = 0.5f * (prior[0] + prior[2]), prior_cy = 0.5f * (prior[1] + prior[3]);
+    float cx = prior_cx + delta[0] * variances[0] * prior_w;
+    float cy = prior_cy + delta[1] * variances[1] * prior_h;
+    float half_w = 0.5f * std::exp(delta[2] * variances[2]) * prior_w;
+    float half_h = 0.5f * std::exp(delta[3] * variances[3]) * prior_h;
+    corner[0] = cx - half_w;
+    corner[1] = cy - half_h;
+    corner[2] = cx + half_w;
+    corner[3] = cy + half_h;
+}
+
+/**
+ * @struct candidate
+ * @brief A box and label with a score above the threshold.
+ */
+struct candidate {
+    float score;
+    int32_t label;
+    uint32_t box;
+};
+
+/**
+ * @struct kept_boxes
+ * @brief Boxes kept by the suppression for one label, as arrays for the vector kernel.
+ */
+struct kept_boxes {
+    std::vector<float> x1, y1, x2, y2, area;
+
+    void clear() {
+        x1.clear();
+        y1.clear();
+        x2.clear();
+        y2.clear();
+        area.clear();
+    }
+
+    void add(const float *box, float box_area) {
+        x1.push_back(box[0]);
+        y1.push_back(box[1]);
+        x2.push_back(box[2]);
+        y2.push_back(box[3]);
+        area.push_back(box_area);
+    }
+};
+
+float boxArea(const float *box) {
+    return std::max(0.0f, box[2] - box[0]) * std::max(0.0f, box[3] - box[1]);
+}
+
+/**
+ *@brief greedy non-maximum suppression per label, then the top_k most confident detections by decreasing score.
+ */
+void suppress(ie_postproc_detection_t *items, size_t &count, float threshold, size_t top_k, kept_boxes &kept) {
+    std::sort(items, items + count, [](const ie_postproc_detection_t &a, const ie_postproc_detection_t &b) {
+        return a.label != b.label ? a.label < b.label : a.score > b.score;
+    });
+    size_t n = 0;
+    kept.clear();
+    for (size_t i = 0; i < count; ++i) {
+        if (n && items[n - 1].label != items[i].label) {
+            kept.clear();
+        }
+        const float *box = &items[i].x_min;
+        float area = boxArea(box);
+        if (threshold < 1.0f && kernels().overlaps(kept.x1.data(), kept.y1.data(), kept.x2.data(), kept.y2.data(),
+                                                   kept.area.data(), kept.x1.size(), box, area, threshold)) {
+            continue;
+        }
+        kept.add(box, area);
+        items[n++] = items[i];
+    }
+    count = std::min(n, top_k);
+    std::partial_sort(items, items + count, items + n, [](const ie_postproc_detection_t &a, const ie_postproc_detection_t &b) {
+        return a.score > b.score;
+    });
+}
+
+/**
+ * @struct item_scratch
+ * @brief Buffers reused for the items of the batch processed by one thread.
+ */
+struct item_scratch {
+    std::vector<uint32_t> indices;
+    std::vector<candidate> candidates;
+    std::vector<ie_postproc_detection_t> detections;
+    kept_boxes kept;
+};
+
+/**
+ *@brief the candidates of one item of the batch, at most pre_nms_top_k per label.
+ */
+void collectCandidates(const ie_postproc_tensors_t &tensors, const ie_postproc_config_t &config, size_t item,
+                       item_scratch &scratch) {
+    std::vector<candidate> &candidates = scratch.candidates;
+    candidates.clear();
+    size_t num_boxes = tensors.num_boxes;
+    size_t num_classes = tensors.num_classes;
+    float threshold = config.score_threshold;
+
+    if (tensors.format == postproc_format_e::POSTPROC_DETECTION_OUTPUT) {
+        for (size_t n = 0; n < num_boxes; ++n) {
+            const float *row = tensors.boxes + n * 7;
+            if (row[0] < 0.0f) {
+                break;
+            }
+            if (static_cast<size_t>(row[0]) == item && row[2] >= threshold && static_cast<int>(row[1]) != config.background_label) {
+                candidates.push_back(candidate{row[2], static_cast<int32_t>(row[1]), static_cast<uint32_t>(n)});
+            }
+        }
+    } else if (tensors.format == postproc_format_e::POSTPROC_YOLO) {
+        size_t stride = 5 + num_classes;
+        const float *rows = tensors.boxes + item * num_boxes * stride;
+        for (size_t n = 0; n < num_boxes; ++n) {
+            const float *row = rows + n * stride;
+            // the score is objectness times the class probability, so a low objectness rules out every class
+            if (row[4] < threshold) {
+                continue;
+            }
+            for (size_t c = 0; c < num_classes; ++c) {
+                float score = row[4] * row[5 + c];
+                if (score >= threshold && static_cast<int>(c) != config.background_label) {
+                    candidates.push_back(candidate{score, static_cast<int32_t>(c), static_cast<uint32_t>(n)});
+                }
+            }
+        }
+    } else {
+        size_t count = num_boxes * num_classes;
+        scratch.indices.resize(count);
+        size_t n = kernels().filter_scores(tensors.scores + item * count, count, threshold, scratch.indices.data());
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t index = scratch.indices[i];
+            int32_t label = static_cast<int32_t>(index % num_classes);
+            if (label != config.background_label) {
+                candidates.push_back(candidate{tensors.scores[item * count + index], label,
+                                               static_cast<uint32_t>(index / num_classes)});
+            }
+        }
+    }
+
+    if (config.pre_nms_top_k == 0) {
+        return;
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const candidate &a, const candidate &b) {
+        return a.label != b.label ? a.label < b.label : a.score > b.score;
+    });
+    size_t kept = 0, in_label = 0;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        in_label = i && candidates[i].label == candidates[i - 1].label ? in_label + 1 : 0;
+        if (in_label < config.pre_nms_top_k) {
+            candidates[kept++] = candidates[i];
+        }
+    }
+    candidates.resize(kept);
+}
+
+void decodeCandidate(const ie_postproc_tensors_t &tensors, const ie_postproc_config_t &config, size_t item,
+                     const candidate &c, float *corner) {
+    size_t n = c.box;
+    switch (tensors.format) {
+    case postproc_format_e::POSTPROC_DETECTION_OUTPUT:
+        memcpy(corner, tensors.boxes + n * 7 + 3, 4 * sizeof(float));
+        break;
+    case postproc_format_e::POSTPROC_YOLO:
+        centerSizeScalar(tensors.boxes + (item * tensors.num_boxes + n) * (5 + tensors.num_classes), 1, corner);
+        break;
+    case postproc_format_e::POSTPROC_BOXES_CENTER_SIZE:
+        centerSizeScalar(tensors.boxes + (item * tensors.num_boxes + n) * 4, 1, corner);
+        break;
+    case postproc_format_e::POSTPROC_SSD_PRIORS:
+        decodePrior(tensors.boxes + (item * tensors.num_boxes + n) * 4, tensors.priors + n * 4, config.variances, corner);
+        break;
+    default:
+        memcpy(corner, tensors.boxes + (item * tensors.num_boxes + n) * 4, 4 * sizeof(float));
+        break;
+    }
+}
+
+void detectItem(const ie_postproc_tensors_t &tensors, const ie_postproc_config_t &config, size_t item,
+                item_scratch &scratch, ie_postproc_detections_t &result) {
+    collectCandidates(tensors, config, item, scratch);
+    std::vector<ie_postproc_detection_t> &detections = scratch.detections;
+    detections.resize(scratch.candidates.size());
+    for (size_t i = 0; i < scratch.candidates.size(); ++i) {
+        const candidate &c = scratch.candidates[i];
+        decodeCandidate(tensors, config, item, c, &detections[i].x_min);
+        detections[i].score = c.score;
+        detections[i].label = c.label;
+        detections[i].box_index = c.box;
+    }
+    size_t top_k = config.top_k && config.top_k < IE_POSTPROC_MAX_DETECTIONS ? config.top_k : IE_POSTPROC_MAX_DETECTIONS;
+    size_t count = detections.size();
+    suppress(detections.data(), count, config.nms_threshold, top_k, scratch.kept);
+    std::copy(detections.begin(), detections.begin() + count, result.items);
+    result.count = count;
+    result.num_candidates = scratch.candidates.size();
+}
+
+bool validTensors(const ie_postproc_tensors_t *tensors) {
+    if (tensors == nullptr || tensors->boxes == nullptr || tensors->batch == 0) {
+        return false;
+    }
+    switch (tensors->format) {
+    case postproc_format_e::POSTPROC_DETECTION_OUTPUT:
+        return true;
+    case postproc_format_e::POSTPROC_YOLO:
+        return tensors->num_classes > 0;
+    case postproc_format_e::POSTPROC_BOXES_CORNERS:
+    case postproc_format_e::POSTPROC_BOXES_CENTER_SIZE:
+        return tensors->num_classes > 0 && tensors->scores;
+    case postproc_format_e::POSTPROC_SSD_PRIORS:
+        return tensors->num_classes > 0 && tensors->scores && tensors->priors;
+    default:
+        return false;
+    }
+}
+
+// Classification top-K. A row of scores is scanned for values above the smallest of the k best found so far, which
+// rules out whole vectors once the heap is full. FP16 rows are converted to FP32 first.
+
+typedef void (*half_to_float_fn)(const uint16_t *src, size_t count, float *dst);
+typedef size_t (*scan_above_fn)(const float *row, size_t begin, size_t end, float threshold, uint32_t *indices);
+typedef float (*max_fn)(const float *row, size_t count);
+typedef float (*exp_sum_fn)(const float *row, size_t count, float shift);
+
+void halfToFloatScalar(const uint16_t *src, size_t count, float *dst) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = halfToFloat(src[i]);
+    }
+}
+
+size_t scanAboveScalar(const float *row, size_t begin, size_t end, float threshold, uint32_t *indices) {
+    size_t n = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (row[i] > threshold) {
+            indices[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+float maxScalar(const float *row, size_t count) {
+    float result = row[0];
+    for (size_t i = 1; i < count; ++i) {
+        result = std::max(result, row[i]);
+    }
+    return result;
+}
+
+float expSumScalar(const float *row, size_t count, float shift) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        sum += std::exp(row[i] - shift);
+    }
+    return sum;
+}
+
+#ifdef IE_C_API_X86_DISPATCH
+__attribute__((target("avx2,f16c"))) void halfToFloatF16c(const uint16_t *src, size_t count, float *dst) {
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i))));
+    }
+    halfToFloatScalar(src + i, count - i, dst + i);
+}
+
+__attribute__((target("avx2"))) size_t scanAboveAvx2(const float *row, size_t begin, size_t end, float threshold,
+                                                     uint32_t *indices) {
+    const __m256 limit = _mm256_set1_ps(threshold);
+    size_t n = 0;
+    size_t i = begin;
+    for (; end - i >= 8; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(row + i), limit, _CMP_GT_OQ));
+        while (mask) {
+            indices[n++] = static_cast<uint32_t>(i + __builtin_ctz(static_cast<unsigned>(mask)));
+            mask &= mask - 1;
+        }
+    }
+    return n + scanAboveScalar(row, i, end, threshold, indices + n);
+}
+
+__attribute__((target("avx2"))) float maxAvx2(const float *row, size_t count) {
+    if (count < 8) {
+        return maxScalar(row, count);
+    }
+    __m256 result = _mm256_loadu_ps(row);
+    size_t i = 8;
+    for (; count - i >= 8; i += 8) {
+        result = _mm256_max_ps(result, _mm256_loadu_ps(row + i));
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, result);
+    float tail = count > i ? maxScalar(row + i, count - i) : lanes[0];
+    return std::max(maxScalar(lanes, 8), tail);
+}
+
+/**
+ *@brief exp of 8 values at most 0: 2^n * p(r) with x = n * ln2 + r, |r| <= ln2 / 2, and a degree 5 polynomial for p,
+ * within 2 ulp of expf. Values below -87 flush to 0.
+ */
+__attribute__((target("avx2,fma"))) __m256 expAvx2(__m256 x) {
+    const __m256 log2e = _mm256_set1_ps(1.44269504088896341f);
+    const __m256 ln2_hi = _mm256_set1_ps(0.693359375f);
+    const __m256 ln2_lo = _mm256_set1_ps(-2.12194440e-4f);
+    x = _mm256_max_ps(x, _mm256_set1_ps(-87.0f));
+    __m256 n = _mm256_round_ps(_mm256_mul_ps(x, log2e), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(n, ln2_hi, x);
+    r = _mm256_fnmadd_ps(n, ln2_lo, r);
+    __m256 p = _mm256_set1_ps(1.9875691500e-4f);
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.3981999507e-3f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(8.3334519073e-3f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(4.1665795894e-2f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.6666665459e-1f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(5.0000001201e-1f));
+    p = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+    __m256i exponent = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(p, _mm256_castsi256_ps(exponent));
+}
+
+__attribute__((target("avx2,fma"))) float expSumAvx2(const float *row, size_t count, float shift) {
+    const __m256 offset = _mm256_set1_ps(shift);
+    __m256 sum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        sum = _mm256_add_ps(sum, expAvx2(_mm256_sub_ps(_mm256_loadu_ps(row + i), offset)));
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, sum);
+    float result = expSumScalar(row + i, count - i, shift);
+    for (float lane : lanes) {
+        result += lane;
+    }
+    return result;
+}
+#endif
+
+struct topk_kernels {
+    half_to_float_fn half_to_float;
+    scan_above_fn scan_above;
+    max_fn max;
+    exp_sum_fn exp_sum;
+};
+
+const topk_kernels &topkKernels() {
+    static const topk_kernels selected = [] {
+#ifdef IE_C_API_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            half_to_float_fn convert = __builtin_cpu_supports("f16c") ? halfToFloatF16c : halfToFloatScalar;
+            return topk_kernels{convert, scanAboveAvx2, maxAvx2, expSumAvx2};
+        }
+#endif
+        return topk_kernels{halfToFloatScalar, scanAboveScalar, maxScalar, expSumScalar};
+    }();
+    return selected;
+}
+
+/**
+ * @struct topk_scratch
+ * @brief Buffers reused for the rows processed by one thread.
+ */
+struct topk_scratch {
+    std::vector<float> row;
+    std::vector<uint32_t> indices;
+    std::vector<ie_topk_entry_t> heap;
+};
+
+bool greaterScore(const ie_topk_entry_t &a, const ie_topk_entry_t &b) {
+    return a.score != b.score ? a.score > b.score : a.index < b.index;
+}
+
+/**
+ *@brief the k best scores of a row by decreasing score, lower indices first among equal scores.
+ */
+void topkRow(const float *row, size_t count, size_t k, bool softmax, topk_scratch &scratch, ie_topk_entry_t *out) {
+    const topk_kernels &kernels = topkKernels();
+    std::vector<ie_topk_entry_t> &heap = scratch.heap;
+    heap.clear();
+    // the heap has the worst of the best k on top
+    for (size_t i = 0; i < k; ++i) {
+        heap.push_back(ie_topk_entry_t{i, row[i]});
+    }
+    std::make_heap(heap.begin(), heap.end(), greaterScore);
+
+    const size_t block = 256;
+    scratch.indices.resize(block);
+    for (size_t begin = k; begin < count; begin += block) {
+        size_t end = std::min(count, begin + block);
+        size_t n = kernels.scan_above(row, begin, end, heap.front().score, scratch.indices.data());
+        for (size_t j = 0; j < n; ++j) {
+            uint32_t index = scratch.indices[j];
+            // the threshold rises while the block is processed
+            if (row[index] > heap.front().score) {
+                std::pop_heap(heap.begin(), heap.end(), greaterScore);
+                heap.back() = ie_topk_entry_t{index, row[index]};
+                std::push_heap(heap.begin(), heap.end(), greaterScore);
+            }
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), greaterScore);
+
+    if (softmax) {
+        float shift = heap.front().score;
+        float sum = kernels.exp_sum(row, count, shift);
+        for (auto &entry : heap) {
+            entry.score = std::exp(entry.score - shift) / sum;
+        }
+    }
+    std::copy(heap.begin(), heap.end(), out);
+}
+
+}  // namespace
+
+IEStatusCode ie_postproc_filter_scores(const float *scores, size_t count, float threshold, uint32_t *indices,
+        size_t *num_indices) {
+    if (scores == nullptr || indices == nullptr || num_indices == nullptr || count > UINT32_MAX) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    *num_indices = kernels().filter_scores(scores, count, threshold, indices);
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_postproc_decode_boxes(postproc_format_e format, const float *boxes, size_t num_boxes, const float *priors,
+        const float variances[4], float *corners) {
+    if (boxes == nullptr || corners == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    switch (format) {
+    case postproc_format_e::POSTPROC_BOXES_CORNERS:
+        if (corners != boxes) {
+            memmove(corners, boxes, num_boxes * 4 * sizeof(float));
+        }
+        break;
+    case postproc_format_e::POSTPROC_BOXES_CENTER_SIZE:
+        kernels().center_size(boxes, num_boxes, corners);
+        break;
+    case postproc_format_e::POSTPROC_SSD_PRIORS:
+        if (priors == nullptr || variances == nullptr) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        for (size_t i = 0; i < num_boxes; ++i) {
+            decodePrior(boxes + i * 4, priors + i * 4, variances, corners + i * 4);
+        }
+        break;
+    default:
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_postproc_nms(ie_postproc_detections_t *detections, float iou_threshold, size_t top_k) {
+    if (detections == nullptr || detections->count > IE_POSTPROC_MAX_DETECTIONS) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        kept_boxes kept;
+        size_t count = detections->count;
+        suppress(detections->items, count, iou_threshold, top_k ? top_k : IE_POSTPROC_MAX_DETECTIONS, kept);
+        detections->count = count;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_postproc_detect(const ie_postproc_tensors_t *tensors, const ie_postproc_config_t *config,
+        ie_postproc_detections_t *results) {
+    if (!validTensors(tensors) || config == nullptr || results == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (tensors->num_boxes * (tensors->num_classes ? tensors->num_classes : 1) > UINT32_MAX) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    try {
+        size_t threads = config->num_threads ? config->num_threads : std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min(threads, tensors->batch);
+        std::atomic<bool> failed{false};
+        auto work = [tensors, config, results, threads, &failed](size_t first) {
+            try {
+                item_scratch scratch;
+                for (size_t item = first; item < tensors->batch; item += threads) {
+                    detectItem(*tensors, *config, item, scratch, results[item]);
+                }
+            } catch (...) {
+                failed = true;
+            }
+        };
+        // items of the batch are independent, the calling thread takes its share
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < threads; ++t) {
+            workers.emplace_back(work, t);
+        }
+        work(0);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        if (failed) {
+            return IEStatusCode::UNEXPECTED;
+        }
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_topk(const ie_blob_t *blob, size_t k, int apply_softmax, ie_topk_results_t *results) {
+    if (blob == nullptr || results == nullptr || k == 0) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        dimensions_t dims;
+        precision_e precision;
+        ie_blob_buffer_t buffer;
+        IEStatusCode status = ie_blob_get_dims(blob, &dims);
+        if (status == IEStatusCode::OK) {
+            status = ie_blob_get_precision(blob, &precision);
+        }
+        if (status == IEStatusCode::OK) {
+            status = ie_blob_get_cbuffer(blob, &buffer);
+        }
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+        if ((precision != precision_e::FP32 && precision != precision_e::FP16) || dims.ranks < 2) {
+            return IEStatusCode::NOT_IMPLEMENTED;
+        }
+
+        // the scores of an item are all its elements, classes of NC or NCHW with spatial dimensions of 1
+        size_t batch = dims.dims[0];
+        size_t count = 1;
+        for (size_t i = 1; i < dims.ranks; ++i) {
+            count *= dims.dims[i];
+        }
+        if (k > count || count > UINT32_MAX) {
+            return IEStatusCode::OUT_OF_BOUNDS;
+        }
+
+        std::unique_ptr<ie_topk_entry_t[]> entries(new ie_topk_entry_t[batch * k]);
+        const uint8_t *data = static_cast<const uint8_t *>(buffer.cbuffer);
+        size_t element_size = precision == precision_e::FP16 ? sizeof(uint16_t) : sizeof(float);
+        // rows are split between threads only when there is enough work to pay for starting them
+        const size_t min_elements_per_thread = 1 << 16;
+        size_t threads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), batch));
+        threads = std::max<size_t>(1, std::min(threads, batch * count / min_elements_per_thread));
+
+        std::atomic<bool> failed{false};
+        auto work = [&](size_t first) {
+            try {
+                topk_scratch scratch;
+                for (size_t item = first; item < batch; item += threads) {
+                    const uint8_t *row = data + item * count * element_size;
+                    const float *scores = reinterpret_cast<const float *>(row);
+                    if (precision == precision_e::FP16) {
+                        scratch.row.resize(count);
+                        topkKernels().half_to_float(reinterpret_cast<const uint16_t *>(row), count, scratch.row.data());
+                        scores = scratch.row.data();
+                    }
+                    topkRow(scores, count, k, apply_softmax != 0, scratch, entries.get() + item * k);
+                }
+            } catch (...) {
+                failed = true;
+            }
+        };
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < threads; ++t) {
+            workers.emplace_back(work, t);
+        }
+        work(0);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        if (failed) {
+            return IEStatusCode::UNEXPECTED;
+        }
+
+        results->entries = entries.release();
+        results->batch = batch;
+        results->k = k;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_topk_results_free(ie_topk_results_t *results) {
+    if (results) {
+        delete[] results->entries;
+        results->entries = NULL;
+        results->batch = 0;
+        results->k = 0;
+    }
+}
@@ -0,0 +1,282 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+/**
+ * @struct capture_file
+ * @brief A capture log mapped read-only, or read into memory where mapping is not available.
+ */
+struct capture_file {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    std::vector<uint8_t> copy;
+
+    ~capture_file() {
+#ifdef __linux__
+        if (mapped) {
+            munmap(const_cast<uint8_t *>(data), size);
+        }
+#endif
+    }
+
+    bool open(const char *path) {
+#ifdef __linux__
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                data = static_cast<const uint8_t *>(addr);
+                size = static_cast<size_t>(st.st_size);
+                mapped = true;
+            }
+        }
+        close(fd);
+#endif
+        if (!mapped) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                return false;
+            }
+            copy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            data = copy.data();
+            size = copy.size();
+        }
+        return true;
+    }
+};
+
+/**
+ * @struct replay_input
+ * @brief One input of a record, pointing into the log.
+ */
+struct replay_input {
+    const char *name;
+    tensor_desc_t desc;
+    void *data;
+    size_t data_size;
+};
+
+struct replay_record {
+    uint64_t timestamp_ns;
+    std::vector<replay_input> inputs;
+};
+
+/**
+ *@brief collects the records of the log. A record cut short, like the last one of a process that was killed, ends the log.
+ */
+bool parseLog(const capture_file &file, std::vector<replay_record> &records) {
+    ie_capture_file_header_t header;
+    if (file.size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, file.data, sizeof(header));
+    if (memcmp(header.magic, IE_CAPTURE_MAGIC, sizeof(header.magic)) != 0 || header.version != IE_CAPTURE_VERSION ||
+        header.header_size < sizeof(header) || header.header_size > file.size) {
+        return false;
+    }
+
+    size_t offset = header.header_size;
+    while (file.size - offset >= sizeof(ie_capture_record_t)) {
+        const auto *record = reinterpret_cast<const ie_capture_record_t *>(file.data + offset);
+        if (record->size < sizeof(ie_capture_record_t) || record->size > file.size - offset) {
+            break;
+        }
+        replay_record parsed;
+        parsed.timestamp_ns = record->timestamp_ns;
+        size_t position = offset + sizeof(ie_capture_record_t);
+        size_t end = offset + record->size;
+        bool valid = true;
+        for (uint32_t i = 0; i < record->num_inputs && valid; ++i) {
+            if (end - position < sizeof(ie_capture_input_t)) {
+                valid = false;
+                break;
+            }
+            const auto *input = reinterpret_cast<const ie_capture_input_t *>(file.data + position);
+            position += sizeof(ie_capture_input_t);
+            if (input->ranks > 8 || input->name_size == 0 || input->name_size > end - position ||
+                input->data_size > end - position - input->name_size) {
+                valid = false;
+                break;
+            }
+            replay_input parsed_input;
+            parsed_input.name = reinterpret_cast<const char *>(file.data + position);
+            if (memchr(parsed_input.name, '\0', input->name_size) == nullptr) {
+                valid = false;
+                break;
+            }
+            position += input->name_size;
+            parsed_input.desc.layout = static_cast<layout_e>(input->layout);
+            parsed_input.desc.precision = static_cast<precision_e>(input->precision);
+            parsed_input.desc.dims.ranks = input->ranks;
+            std::copy(input->dims, input->dims + input->ranks, parsed_input.desc.dims.dims);
+            // inputs are only read by the device, the blob wraps the log in place
+            parsed_input.data = const_cast<uint8_t *>(file.data + position);
+            parsed_input.data_size = static_cast<size_t>(input->data_size);
+            position += (input->data_size + 7) & ~static_cast<uint64_t>(7);
+            parsed.inputs.push_back(parsed_input);
+        }
+        if (!valid || position > end) {
+            break;
+        }
+        records.push_back(std::move(parsed));
+        offset = end;
+    }
+    return true;
+}
+
+/**
+ * @struct replay_slot
+ * @brief An infer request of the replay with the submit time of its inference in flight, and the latencies of its
+ * completed inferences. A request runs one inference at a time, so its callback writes them without a lock.
+ */
+struct replay_slot : pooled_request {
+    std::chrono::steady_clock::time_point submitted;
+    std::vector<double> latencies_ms;
+};
+
+void completed(pooled_request &pooled) {
+    replay_slot &slot = static_cast<replay_slot &>(pooled);
+    slot.latencies_ms.push_back(
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - slot.submitted).count());
+}
+
+double percentile(const std::vector<double> &sorted, double p) {
+    size_t index = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+}  // namespace
+
+IEStatusCode ie_replay_run(ie_executable_network_t *exe_network, const char *path, \
+        const ie_replay_config_t *config, ie_replay_report_t *report) {
+    if (exe_network == nullptr || path == nullptr || report == nullptr || (config && config->speed < 0.0)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        capture_file file;
+        if (!file.open(path)) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        std::vector<replay_record> records;
+        if (!parseLog(file, records)) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+
+        double speed = config ? config->speed : 1.0;
+        size_t num_requests = config && config->num_requests ? config->num_requests : 4;
+        request_pool pool;
+        pool.on_complete = completed;
+        IEStatusCode status = IEStatusCode::OK;
+        for (size_t i = 0; i < num_requests && status == IEStatusCode::OK; ++i) {
+            std::unique_ptr<replay_slot> slot(new replay_slot);
+            slot->latencies_ms.reserve(records.size() / num_requests + 1);
+            status = pool.add(exe_network, std::move(slot));
+        }
+
+        // offsets are taken from the earliest record, a log written out of order must not make them wrap around
+        uint64_t first_ns = records.empty() ? 0 : records[0].timestamp_ns;
+        for (const replay_record &record : records) {
+            first_ns = std::min(first_ns, record.timestamp_ns);
+        }
+
+        size_t failed = 0;
+        double max_lag_ms = 0.0;
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < records.size() && status == IEStatusCode::OK; ++i) {
+            const replay_record &record = records[i];
+            auto scheduled = begin;
+            if (speed > 0.0) {
+                scheduled += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double, std::nano>((record.timestamp_ns - first_ns) / speed));
+                std::this_thread::sleep_until(scheduled);
+            }
+
+            replay_slot *slot = static_cast<replay_slot *>(pool.acquire());
+            failed += !succeeded(*slot);
+            if (speed > 0.0) {
+                max_lag_ms = std::max(max_lag_ms,
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - scheduled).count());
+            }
+
+            for (const replay_input &input : record.inputs) {
+                ie_blob_t *blob = nullptr;
+                status = ie_blob_make_memory_from_preallocated(&input.desc, input.data, input.data_size, &blob);
+                if (status == IEStatusCode::OK) {
+                    // the request keeps its own reference to the blob
+                    status = ie_infer_request_set_blob(slot->request, input.name, blob);
+                    ie_blob_free(&blob);
+                }
+                if (status != IEStatusCode::OK) {
+                    break;
+                }
+            }
+            slot->submitted = std::chrono::steady_clock::now();
+            if (status == IEStatusCode::OK) {
+                status = pool.start(slot);
+            } else {
+                pool.release(slot);
+            }
+        }
+
+        failed += pool.waitIdle();
+        double duration_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+
+        std::vector<double> latencies;
+        latencies.reserve(records.size());
+        for (const auto &slot : pool.slots) {
+            const std::vector<double> &slot_latencies = static_cast<const replay_slot &>(*slot).latencies_ms;
+            latencies.insert(latencies.end(), slot_latencies.begin(), slot_latencies.end());
+        }
+        std::sort(latencies.begin(), latencies.end());
+        *report = ie_replay_report_t{};
+        report->num_inferences = records.size();
+        report->num_failed = failed;
+        report->duration_ms = duration_ms;
+        report->max_lag_ms = max_lag_ms;
+        if (!latencies.empty()) {
+            double sum = 0.0;
+            for (double latency : latencies) {
+                sum += latency;
+            }
+            report->latency_avg_ms = sum / latencies.size();
+            report->latency_p50_ms = percentile(latencies, 50.0);
+            report->latency_p90_ms = percentile(latencies, 90.0);
+            report->latency_p99_ms = percentile(latencies, 99.0);
+            report->latency_max_ms = latencies.back();
+        }
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
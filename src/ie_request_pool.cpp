@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+void pooledCompleted(void *args) {
+    pooled_request *slot = static_cast<pooled_request *>(args);
+    request_pool &pool = *slot->pool;
+    if (pool.on_complete) {
+        pool.on_complete(*slot);
+    }
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.idle.push_back(slot);
+    pool.cv.notify_one();
+}
+
+}  // namespace
+
+request_pool::~request_pool() {
+    waitIdle();
+    for (auto &slot : slots) {
+        ie_infer_request_free(&slot->request);
+    }
+}
+
+IEStatusCode request_pool::add(ie_executable_network_t *exe_network, std::unique_ptr<pooled_request> slot) {
+    slot->pool = this;
+    slot->callback.completeCallBackFunc = pooledCompleted;
+    slot->callback.args = slot.get();
+    IEStatusCode status = ie_exec_network_create_infer_request(exe_network, &slot->request);
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+    // kept on failure, so that the request is freed with the pool
+    status = ie_infer_set_completion_callback(slot->request, &slot->callback);
+    std::lock_guard<std::mutex> lock(mutex);
+    idle.push_back(slot.get());
+    slots.push_back(std::move(slot));
+    return status;
+}
+
+pooled_request *request_pool::acquire() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return !idle.empty(); });
+    pooled_request *slot = idle.back();
+    idle.pop_back();
+    return slot;
+}
+
+void request_pool::release(pooled_request *slot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    idle.push_back(slot);
+    cv.notify_one();
+}
+
+IEStatusCode request_pool::start(pooled_request *slot) {
+    IEStatusCode status = ie_infer_request_infer_async(slot->request);
+    if (status == IEStatusCode::OK) {
+        slot->pending = true;
+    } else {
+        release(slot);
+    }
+    return status;
+}
+
+size_t request_pool::waitIdle() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return idle.size() == slots.size(); });
+    }
+    size_t failed = 0;
+    for (auto &slot : slots) {
+        failed += !succeeded(*slot);
+    }
+    return failed;
+}
+
+bool succeeded(pooled_request &slot) {
+    if (!slot.pending) {
+        return true;
+    }
+    slot.pending = false;
+    return ie_infer_request_wait(slot.request, -1) == IEStatusCode::OK;
+}
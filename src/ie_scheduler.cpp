@@ -0,0 +1,339 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+typedef std::chrono::steady_clock clock_type;
+
+struct sched_job {
+    ie_scheduler_job_t job;
+    double tag;
+    clock_type::time_point enqueued;
+};
+
+struct sched_flow {
+    double weight = 1.0;
+    double last_finish = 0.0;
+    std::deque<sched_job> jobs;
+};
+
+struct sched_class {
+    double vtime = 0.0;
+    size_t queued = 0;
+    size_t in_flight = 0;
+    size_t submitted = 0;
+    size_t rejected = 0;
+    size_t completed = 0;
+    size_t started = 0;
+    double total_wait_ms = 0.0;
+    double max_wait_ms = 0.0;
+    std::map<uint32_t, sched_flow> flows;
+};
+
+}  // namespace
+
+struct ie_scheduler;
+
+/**
+ * @struct sched_slot
+ * @brief One infer request of the pool together with the job it currently runs.
+ */
+struct sched_slot {
+    ie_scheduler *owner;
+    ie_infer_request_t *request;
+    ie_complete_call_back_t callback;
+    ie_scheduler_job_t job;
+    size_t class_id;
+};
+
+/**
+ * @struct ie_scheduler
+ * @brief Strict-priority classes with weighted fair queueing of flows inside every class,
+ * in front of a pool of infer requests of one executable network.
+ */
+struct ie_scheduler {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<sched_slot>> slots;
+    std::vector<sched_slot *> idle;
+    std::vector<sched_class> classes;
+    size_t max_queue_depth = 0;
+    bool stop = false;
+    std::thread dispatcher;
+};
+
+namespace {
+
+void scheduler_release_slot(sched_slot *slot) {
+    ie_scheduler *sched = slot->owner;
+
+    // notify under the lock, ie_scheduler_free() may destroy the scheduler as soon as the slot is idle.
+    std::lock_guard<std::mutex> lock(sched->mutex);
+    sched_class &cls = sched->classes[slot->class_id];
+    --cls.in_flight;
+    ++cls.completed;
+    sched->idle.push_back(slot);
+    sched->cv.notify_all();
+}
+
+void scheduler_on_complete(void *args) {
+    sched_slot *slot = static_cast<sched_slot *>(args);
+    if (slot->job.complete) {
+        slot->job.complete(slot->request, inferRequestStatus(slot->request), slot->job.args);
+    }
+    scheduler_release_slot(slot);
+}
+
+/**
+ *@brief pops the job with the smallest finish tag of the highest priority non-empty class.
+ */
+bool scheduler_pop(ie_scheduler *sched, sched_job *job, size_t *class_id) {
+    for (size_t c = 0; c < sched->classes.size(); ++c) {
+        sched_class &cls = sched->classes[c];
+        if (cls.queued == 0) {
+            continue;
+        }
+
+        sched_flow *best = nullptr;
+        for (auto &it : cls.flows) {
+            if (!it.second.jobs.empty() && (best == nullptr || it.second.jobs.front().tag < best->jobs.front().tag)) {
+                best = &it.second;
+            }
+        }
+
+        *job = best->jobs.front();
+        best->jobs.pop_front();
+        --cls.queued;
+        cls.vtime = job->tag;
+        *class_id = c;
+        return true;
+    }
+    return false;
+}
+
+void scheduler_dispatch(ie_scheduler *sched) {
+    std::unique_lock<std::mutex> lock(sched->mutex);
+    while (true) {
+        sched->cv.wait(lock, [sched] {
+            if (sched->stop) {
+                return true;
+            }
+            if (sched->idle.empty()) {
+                return false;
+            }
+            for (const auto &cls : sched->classes) {
+                if (cls.queued) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        if (sched->stop) {
+            return;
+        }
+
+        sched_job job;
+        size_t class_id = 0;
+        scheduler_pop(sched, &job, &class_id);
+        sched_slot *slot = sched->idle.back();
+        sched->idle.pop_back();
+
+        sched_class &cls = sched->classes[class_id];
+        double wait_ms = std::chrono::duration<double, std::milli>(clock_type::now() - job.enqueued).count();
+        cls.total_wait_ms += wait_ms;
+        cls.max_wait_ms = std::max(cls.max_wait_ms, wait_ms);
+        ++cls.started;
+        ++cls.in_flight;
+
+        slot->job = job.job;
+        slot->class_id = class_id;
+        lock.unlock();
+
+        IEStatusCode status = IEStatusCode::OK;
+        if (slot->job.prepare) {
+            status = slot->job.prepare(slot->request, slot->job.args);
+        }
+        if (status == IEStatusCode::OK) {
+            status = ie_infer_request_infer_async(slot->request);
+        }
+        if (status != IEStatusCode::OK) {
+            if (slot->job.complete) {
+                slot->job.complete(slot->request, status, slot->job.args);
+            }
+            scheduler_release_slot(slot);
+        }
+
+        lock.lock();
+    }
+}
+
+}  // namespace
+
+IEStatusCode ie_scheduler_create(ie_executable_network_t *ie_exec_network, const ie_scheduler_config_t *config, ie_scheduler_t **scheduler) {
+    if (ie_exec_network == nullptr || config == nullptr || scheduler == nullptr || config->num_classes == 0) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_scheduler_t> sched(new ie_scheduler_t);
+        sched->classes.resize(config->num_classes);
+        sched->max_queue_depth = config->max_queue_depth;
+
+        size_t num_requests = std::max<size_t>(config->num_requests, 1);
+        for (size_t i = 0; i < num_requests; ++i) {
+            std::unique_ptr<sched_slot> slot(new sched_slot());
+            slot->owner = sched.get();
+            IEStatusCode status = ie_exec_network_create_infer_request(ie_exec_network, &slot->request);
+            if (status != IEStatusCode::OK) {
+                for (auto &s : sched->slots) {
+                    ie_infer_request_free(&s->request);
+                }
+                return status;
+            }
+            slot->callback.completeCallBackFunc = scheduler_on_complete;
+            slot->callback.args = slot.get();
+            status = ie_infer_set_completion_callback(slot->request, &slot->callback);
+            sched->idle.push_back(slot.get());
+            sched->slots.push_back(std::move(slot));
+            if (status != IEStatusCode::OK) {
+                for (auto &s : sched->slots) {
+                    ie_infer_request_free(&s->request);
+                }
+                return status;
+            }
+        }
+
+        sched->dispatcher = std::thread(scheduler_dispatch, sched.get());
+        *scheduler = sched.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_scheduler_free(ie_scheduler_t **scheduler) {
+    if (scheduler == nullptr || *scheduler == nullptr) {
+        return;
+    }
+
+    ie_scheduler_t *sched = *scheduler;
+    {
+        std::lock_guard<std::mutex> lock(sched->mutex);
+        sched->stop = true;
+    }
+    sched->cv.notify_all();
+    sched->dispatcher.join();
+
+    std::vector<sched_job> cancelled;
+    {
+        std::unique_lock<std::mutex> lock(sched->mutex);
+        sched->cv.wait(lock, [sched] { return sched->idle.size() == sched->slots.size(); });
+        for (auto &cls : sched->classes) {
+            for (auto &flow : cls.flows) {
+                cancelled.insert(cancelled.end(), flow.second.jobs.begin(), flow.second.jobs.end());
+                flow.second.jobs.clear();
+            }
+            cls.queued = 0;
+        }
+    }
+    for (auto &job : cancelled) {
+        if (job.job.complete) {
+            job.job.complete(nullptr, IEStatusCode::INFER_NOT_STARTED, job.job.args);
+        }
+    }
+
+    for (auto &slot : sched->slots) {
+        ie_infer_request_free(&slot->request);
+    }
+    delete sched;
+    *scheduler = NULL;
+}
+
+IEStatusCode ie_scheduler_set_flow_weight(ie_scheduler_t *scheduler, size_t class_id, uint32_t flow_id, double weight) {
+    if (scheduler == nullptr || !(weight > 0.0)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(scheduler->mutex);
+    if (class_id >= scheduler->classes.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+    scheduler->classes[class_id].flows[flow_id].weight = weight;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_scheduler_submit(ie_scheduler_t *scheduler, size_t class_id, uint32_t flow_id, const ie_scheduler_job_t *job) {
+    if (scheduler == nullptr || job == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(scheduler->mutex);
+        if (class_id >= scheduler->classes.size()) {
+            return IEStatusCode::OUT_OF_BOUNDS;
+        }
+        if (scheduler->stop) {
+            return IEStatusCode::INFER_NOT_STARTED;
+        }
+
+        sched_class &cls = scheduler->classes[class_id];
+        if (scheduler->max_queue_depth && cls.queued >= scheduler->max_queue_depth) {
+            ++cls.rejected;
+            return IEStatusCode::REQUEST_BUSY;
+        }
+
+        // virtual finish time fair queueing: a backlogged flow advances its finish tag by 1/weight per job,
+        // an idle flow restarts from the virtual time of the class.
+        sched_flow &flow = cls.flows[flow_id];
+        sched_job entry;
+        entry.job = *job;
+        entry.tag = std::max(cls.vtime, flow.last_finish) + 1.0 / flow.weight;
+        entry.enqueued = clock_type::now();
+        flow.last_finish = entry.tag;
+        flow.jobs.push_back(entry);
+        ++cls.queued;
+        ++cls.submitted;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+    scheduler->cv.notify_all();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_scheduler_get_class_stats(ie_scheduler_t *scheduler, size_t class_id, ie_scheduler_class_stats_t *stats) {
+    if (scheduler == nullptr || stats == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(scheduler->mutex);
+    if (class_id >= scheduler->classes.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    const sched_class &cls = scheduler->classes[class_id];
+    stats->queue_depth = cls.queued;
+    stats->in_flight = cls.in_flight;
+    stats->submitted = cls.submitted;
+    stats->rejected = cls.rejected;
+    stats->completed = cls.completed;
+    stats->avg_wait_ms = cls.started ? cls.total_wait_ms / cls.started : 0.0;
+    stats->max_wait_ms = cls.max_wait_ms;
+
+    return IEStatusCode::OK;
+}
@@ -0,0 +1,536 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+/**
+ * @struct tile
+ * @brief A tile of the image, and the part of the image its dense output is kept for: up to the middle of the overlap
+ * with each neighbour.
+ */
+struct tile {
+    size_t x, y, width, height;
+    size_t own_x0, own_x1, own_y0, own_y1;
+};
+
+/**
+ * @struct tiler_run
+ * @brief The image being tiled and the merged outputs of its tiles.
+ */
+struct tiler_run {
+    const uint8_t *image = nullptr;
+    tensor_desc_t image_desc;
+    std::vector<tile> tiles;
+    std::mutex mutex;
+    std::vector<ie_tiler_detection_t> detections;
+    float *dense = nullptr;
+    size_t dense_height = 0;
+    size_t dense_width = 0;
+};
+
+}  // namespace
+
+/**
+ * @struct ie_tiler
+ * @brief This struct represents a tiler with the infer requests running the tiles of an image.
+ */
+struct ie_tiler {
+    std::string input;
+    std::string output;
+    ie_tiler_config_t config;
+    tensor_desc_t input_desc;   // of the network input, its batch is the number of tiles per inference
+    tensor_desc_t output_desc;
+    bool detection = false;     // the output is a DetectionOutput [1, 1, N, 7], otherwise a dense NCHW FP32 map
+    double scale_y = 1.0;       // output rows per input row of a dense output
+    double scale_x = 1.0;
+
+    std::mutex run_mutex;       // runs are serialized, they share the requests
+    request_pool pool;
+    tiler_run *run = nullptr;
+};
+
+namespace {
+
+/**
+ * @struct tiler_slot
+ * @brief An infer request of the tiler with the tiles of its inference in flight.
+ */
+struct tiler_slot : pooled_request {
+    ie_tiler_t *tiler = nullptr;
+    uint8_t *input = nullptr;
+    const uint8_t *output = nullptr;
+    std::vector<size_t> tiles;
+};
+
+size_t dimsSize(const dimensions_t &dims) {
+    size_t size = 1;
+    for (size_t i = 0; i < dims.ranks; ++i) {
+        size *= dims.dims[i];
+    }
+    return size;
+}
+
+/**
+ *@brief starts of the tiles along one side of the image, the last one aligned with the end of the image.
+ */
+std::vector<size_t> tileStarts(size_t image, size_t tile_size, size_t overlap) {
+    std::vector<size_t> starts(1, 0);
+    if (image <= tile_size) {
+        return starts;
+    }
+    // the overlap is smaller than the tile, checked by ie_tiler_create()
+    size_t stride = tile_size - overlap;
+    while (starts.back() + tile_size < image) {
+        starts.push_back(std::min(starts.back() + stride, image - tile_size));
+    }
+    return starts;
+}
+
+/**
+ *@brief the part of the image owned by each tile along one side: tiles split their overlap in the middle.
+ */
+void ownRanges(const std::vector<size_t> &starts, size_t tile_size, size_t image, std::vector<size_t> &begin,
+               std::vector<size_t> &end) {
+    size_t n = starts.size();
+    begin.resize(n);
+    end.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        begin[i] = i == 0 ? 0 : (starts[i] + starts[i - 1] + tile_size) / 2;
+        end[i] = i + 1 == n ? image : (starts[i + 1] + starts[i] + tile_size) / 2;
+    }
+}
+
+/**
+ *@brief offset of element (c, y, x) of an image with the channels planar (NCHW) or interleaved (NHWC).
+ */
+size_t elementOffset(layout_e layout, size_t channels, size_t height, size_t width, size_t c, size_t y, size_t x) {
+    return layout == layout_e::NHWC ? (y * width + x) * channels + c : (c * height + y) * width + x;
+}
+
+float readElement(const uint8_t *data, precision_e precision, size_t offset) {
+    if (precision == precision_e::U8) {
+        return data[offset];
+    }
+    float value;
+    memcpy(&value, data + offset * sizeof(float), sizeof(value));
+    return value;
+}
+
+void writeElement(uint8_t *data, precision_e precision, size_t offset, float value) {
+    if (precision == precision_e::U8) {
+        data[offset] = static_cast<uint8_t>(std::min(255.0f, std::max(0.0f, value + 0.5f)));
+    } else {
+        memcpy(data + offset * sizeof(float), &value, sizeof(value));
+    }
+}
+
+size_t elementSize(precision_e precision) {
+    return precision == precision_e::U8 ? 1 : sizeof(float);
+}
+
+/**
+ *@brief copies a tile of the image to one item of the batch of the network input, converting layout and precision.
+ * A tile smaller than the input, from an image smaller than the input, is padded with zeros at the right and bottom.
+ */
+void copyTile(const tiler_run &run, const tile &t, const tensor_desc_t &input_desc, uint8_t *item) {
+    size_t channels = input_desc.dims.dims[1];
+    size_t height = input_desc.dims.dims[2];
+    size_t width = input_desc.dims.dims[3];
+    size_t image_height = run.image_desc.dims.dims[2];
+    size_t image_width = run.image_desc.dims.dims[3];
+    size_t element_size = elementSize(input_desc.precision);
+    if (t.width < width || t.height < height) {
+        memset(item, 0, channels * height * width * element_size);
+    }
+
+    layout_e src_layout = run.image_desc.layout;
+    precision_e src_precision = run.image_desc.precision;
+    if (src_layout == input_desc.layout && src_precision == input_desc.precision) {
+        // rows of the tile are contiguous in both, planes of the NCHW layout are copied one by one
+        size_t planes = src_layout == layout_e::NHWC ? 1 : channels;
+        size_t pixel = (src_layout == layout_e::NHWC ? channels : 1) * element_size;
+        for (size_t c = 0; c < planes; ++c) {
+            for (size_t y = 0; y < t.height; ++y) {
+                size_t src = elementOffset(src_layout, channels, image_height, image_width, c, t.y + y, t.x);
+                size_t dst = elementOffset(src_layout, channels, height, width, c, y, 0);
+                memcpy(item + dst * element_size, run.image + src * element_size, t.width * pixel);
+            }
+        }
+        return;
+    }
+    for (size_t c = 0; c < channels; ++c) {
+        for (size_t y = 0; y < t.height; ++y) {
+            for (size_t x = 0; x < t.width; ++x) {
+                size_t src = elementOffset(src_layout, channels, image_height, image_width, c, t.y + y, t.x + x);
+                size_t dst = elementOffset(input_desc.layout, channels, height, width, c, y, x);
+                writeElement(item, input_desc.precision, dst, readElement(run.image, src_precision, src));
+            }
+        }
+    }
+}
+
+/**
+ *@brief maps the detections of the tiles of an inference to image coordinates in pixels.
+ */
+void mergeDetections(ie_tiler_t &tiler, tiler_run &run, const tiler_slot &slot) {
+    const float *rows = reinterpret_cast<const float *>(slot.output);
+    size_t max_detections = tiler.output_desc.dims.dims[2];
+    float input_height = static_cast<float>(tiler.input_desc.dims.dims[2]);
+    float input_width = static_cast<float>(tiler.input_desc.dims.dims[3]);
+    std::vector<ie_tiler_detection_t> detections;
+    for (size_t i = 0; i < max_detections; ++i) {
+        const float *row = rows + i * 7;
+        if (row[0] < 0.0f) {
+            break;
+        }
+        size_t item = static_cast<size_t>(row[0]);
+        if (item >= slot.tiles.size() || row[2] < tiler.config.confidence_threshold) {
+            continue;
+        }
+        const tile &t = run.tiles[slot.tiles[item]];
+        // boxes are relative to the network input, which a tile smaller than it does not fill
+        ie_tiler_detection_t detection;
+        detection.label = static_cast<int>(row[1]);
+        detection.confidence = row[2];
+        detection.x_min = t.x + std::min(row[3] * input_width, static_cast<float>(t.width));
+        detection.y_min = t.y + std::min(row[4] * input_height, static_cast<float>(t.height));
+        detection.x_max = t.x + std::min(row[5] * input_width, static_cast<float>(t.width));
+        detection.y_max = t.y + std::min(row[6] * input_height, static_cast<float>(t.height));
+        detections.push_back(detection);
+    }
+    std::lock_guard<std::mutex> lock(run.mutex);
+    run.detections.insert(run.detections.end(), detections.begin(), detections.end());
+}
+
+/**
+ *@brief copies the part of the dense output of each tile it owns into the output of the image. Tiles own disjoint
+ * parts, so inferences completing at the same time write without a lock.
+ */
+void mergeDense(ie_tiler_t &tiler, tiler_run &run, const tiler_slot &slot) {
+    const float *output = reinterpret_cast<const float *>(slot.output);
+    size_t channels = tiler.output_desc.dims.dims[1];
+    size_t height = tiler.output_desc.dims.dims[2];
+    size_t width = tiler.output_desc.dims.dims[3];
+    for (size_t item = 0; item < slot.tiles.size(); ++item) {
+        const tile &t = run.tiles[slot.tiles[item]];
+        size_t tile_y = static_cast<size_t>(std::lround(t.y * tiler.scale_y));
+        size_t tile_x = static_cast<size_t>(std::lround(t.x * tiler.scale_x));
+        size_t y0 = static_cast<size_t>(std::lround(t.own_y0 * tiler.scale_y));
+        size_t y1 = std::min(static_cast<size_t>(std::lround(t.own_y1 * tiler.scale_y)), std::min(run.dense_height, tile_y + height));
+        size_t x0 = static_cast<size_t>(std::lround(t.own_x0 * tiler.scale_x));
+        size_t x1 = std::min(static_cast<size_t>(std::lround(t.own_x1 * tiler.scale_x)), std::min(run.dense_width, tile_x + width));
+        if (y1 <= y0 || x1 <= x0) {
+            continue;
+        }
+        for (size_t c = 0; c < channels; ++c) {
+            const float *plane = output + (item * channels + c) * height * width;
+            for (size_t y = y0; y < y1; ++y) {
+                memcpy(run.dense + (c * run.dense_height + y) * run.dense_width + x0,
+                       plane + (y - tile_y) * width + (x0 - tile_x), (x1 - x0) * sizeof(float));
+            }
+        }
+    }
+}
+
+void tileCompleted(pooled_request &pooled) {
+    tiler_slot &slot = static_cast<tiler_slot &>(pooled);
+    ie_tiler_t &tiler = *slot.tiler;
+    tiler_run &run = *tiler.run;
+    if (tiler.detection) {
+        mergeDetections(tiler, run, slot);
+    } else {
+        mergeDense(tiler, run, slot);
+    }
+}
+
+float iou(const ie_tiler_detection_t &a, const ie_tiler_detection_t &b) {
+    float width = std::min(a.x_max, b.x_max) - std::max(a.x_min, b.x_min);
+    float height = std::min(a.y_max, b.y_max) - std::max(a.y_min, b.y_min);
+    if (width <= 0.0f || height <= 0.0f) {
+        return 0.0f;
+    }
+    float intersection = width * height;
+    float area_a = (a.x_max - a.x_min) * (a.y_max - a.y_min);
+    float area_b = (b.x_max - b.x_min) * (b.y_max - b.y_min);
+    return intersection / (area_a + area_b - intersection);
+}
+
+/**
+ *@brief greedy non-maximum suppression per label, which removes the duplicates of objects seen by overlapping tiles.
+ */
+std::vector<ie_tiler_detection_t> suppress(std::vector<ie_tiler_detection_t> &detections, float threshold) {
+    std::sort(detections.begin(), detections.end(), [](const ie_tiler_detection_t &a, const ie_tiler_detection_t &b) {
+        return a.label != b.label ? a.label < b.label : a.confidence > b.confidence;
+    });
+    std::vector<ie_tiler_detection_t> kept;
+    size_t label_begin = 0;
+    for (const auto &candidate : detections) {
+        if (!kept.empty() && kept.back().label != candidate.label) {
+            label_begin = kept.size();
+        }
+        bool overlaps = false;
+        for (size_t i = label_begin; i < kept.size() && !overlaps; ++i) {
+            overlaps = iou(kept[i], candidate) > threshold;
+        }
+        if (!overlaps) {
+            kept.push_back(candidate);
+        }
+    }
+    std::sort(kept.begin(), kept.end(), [](const ie_tiler_detection_t &a, const ie_tiler_detection_t &b) {
+        return a.confidence > b.confidence;
+    });
+    return kept;
+}
+
+bool supportedDesc(const tensor_desc_t &desc) {
+    return desc.dims.ranks == 4 && (desc.layout == layout_e::NCHW || desc.layout == layout_e::NHWC) &&
+        (desc.precision == precision_e::U8 || desc.precision == precision_e::FP32);
+}
+
+IEStatusCode getDesc(ie_blob_t *blob, tensor_desc_t &desc) {
+    IEStatusCode status = ie_blob_get_layout(blob, &desc.layout);
+    if (status == IEStatusCode::OK) {
+        status = ie_blob_get_dims(blob, &desc.dims);
+    }
+    if (status == IEStatusCode::OK) {
+        status = ie_blob_get_precision(blob, &desc.precision);
+    }
+    return status;
+}
+
+/**
+ *@brief creates an infer request of the tiler and maps its input and output blobs, which stay the same for its lifetime.
+ */
+IEStatusCode createSlot(ie_executable_network_t *exe_network, ie_tiler_t &tiler) {
+    std::unique_ptr<tiler_slot> owned(new tiler_slot);
+    tiler_slot *slot = owned.get();
+    slot->tiler = &tiler;
+    IEStatusCode status = tiler.pool.add(exe_network, std::move(owned));
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+    ie_blob_t *input = nullptr;
+    ie_blob_t *output = nullptr;
+    ie_blob_buffer_t buffer;
+    status = ie_infer_request_get_blob(slot->request, tiler.input.c_str(), &input);
+    if (status == IEStatusCode::OK) {
+        status = ie_infer_request_get_blob(slot->request, tiler.output.c_str(), &output);
+    }
+    if (status == IEStatusCode::OK && tiler.pool.slots.size() == 1) {
+        status = getDesc(input, tiler.input_desc);
+        if (status == IEStatusCode::OK) {
+            status = getDesc(output, tiler.output_desc);
+        }
+    }
+    if (status == IEStatusCode::OK) {
+        status = ie_blob_get_buffer(input, &buffer);
+        slot->input = static_cast<uint8_t *>(buffer.buffer);
+    }
+    if (status == IEStatusCode::OK) {
+        status = ie_blob_get_cbuffer(output, &buffer);
+        slot->output = static_cast<const uint8_t *>(buffer.cbuffer);
+    }
+    // the request keeps its own reference to the blobs
+    ie_blob_free(&input);
+    ie_blob_free(&output);
+    return status;
+}
+
+}  // namespace
+
+IEStatusCode ie_tiler_create(ie_executable_network_t *exe_network, const ie_tiler_config_t *config, ie_tiler_t **tiler) {
+    if (exe_network == nullptr || config == nullptr || config->input_name == nullptr || config->output_name == nullptr ||
+        tiler == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_tiler_t> result(new ie_tiler_t);
+        result->input = config->input_name;
+        result->output = config->output_name;
+        result->config = *config;
+        result->pool.on_complete = tileCompleted;
+
+        size_t num_requests = config->num_requests;
+        if (num_requests == 0) {
+            ie_param_t param;
+            num_requests = ie_exec_network_get_metric(exe_network, "OPTIMAL_NUMBER_OF_INFER_REQUESTS", &param) ==
+                IEStatusCode::OK && param.number ? param.number : 4;
+        }
+        IEStatusCode status = IEStatusCode::OK;
+        for (size_t i = 0; i < num_requests && status == IEStatusCode::OK; ++i) {
+            status = createSlot(exe_network, *result);
+        }
+        if (status == IEStatusCode::OK && !supportedDesc(result->input_desc)) {
+            status = IEStatusCode::NOT_IMPLEMENTED;
+        }
+        // tiles must advance by at least one pixel less than their size
+        if (status == IEStatusCode::OK && (config->overlap >= result->input_desc.dims.dims[2] ||
+                                           config->overlap >= result->input_desc.dims.dims[3])) {
+            status = IEStatusCode::OUT_OF_BOUNDS;
+        }
+
+        const tensor_desc_t &input = result->input_desc;
+        const tensor_desc_t &output = result->output_desc;
+        bool fp32_4d = output.dims.ranks == 4 && output.precision == precision_e::FP32;
+        if (fp32_4d && output.dims.dims[3] == 7) {
+            result->detection = true;
+        } else if (fp32_4d && output.layout == layout_e::NCHW && output.dims.dims[0] == input.dims.dims[0]) {
+            result->scale_y = static_cast<double>(output.dims.dims[2]) / input.dims.dims[2];
+            result->scale_x = static_cast<double>(output.dims.dims[3]) / input.dims.dims[3];
+        } else if (status == IEStatusCode::OK) {
+            status = IEStatusCode::NOT_IMPLEMENTED;
+        }
+
+        // the requests are freed with the pool
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+        *tiler = result.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_tiler_free(ie_tiler_t **tiler) {
+    if (tiler && *tiler) {
+        delete *tiler;
+        *tiler = NULL;
+    }
+}
+
+IEStatusCode ie_tiler_run(ie_tiler_t *tiler, const ie_blob_t *image, ie_tiler_result_t *result) {
+    if (tiler == nullptr || image == nullptr || result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        tiler_run run;
+        ie_blob_buffer_t buffer;
+        IEStatusCode status = getDesc(const_cast<ie_blob_t *>(image), run.image_desc);
+        if (status == IEStatusCode::OK) {
+            status = ie_blob_get_cbuffer(image, &buffer);
+        }
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+        const tensor_desc_t &input_desc = tiler->input_desc;
+        if (!supportedDesc(run.image_desc) || run.image_desc.dims.dims[0] != 1 ||
+            run.image_desc.dims.dims[1] != input_desc.dims.dims[1]) {
+            return IEStatusCode::NOT_IMPLEMENTED;
+        }
+        run.image = static_cast<const uint8_t *>(buffer.cbuffer);
+
+        size_t image_height = run.image_desc.dims.dims[2];
+        size_t image_width = run.image_desc.dims.dims[3];
+        size_t tile_height = input_desc.dims.dims[2];
+        size_t tile_width = input_desc.dims.dims[3];
+        std::vector<size_t> ys = tileStarts(image_height, tile_height, tiler->config.overlap);
+        std::vector<size_t> xs = tileStarts(image_width, tile_width, tiler->config.overlap);
+        std::vector<size_t> own_y0, own_y1, own_x0, own_x1;
+        ownRanges(ys, tile_height, image_height, own_y0, own_y1);
+        ownRanges(xs, tile_width, image_width, own_x0, own_x1);
+        for (size_t i = 0; i < ys.size(); ++i) {
+            for (size_t j = 0; j < xs.size(); ++j) {
+                tile t = {xs[j], ys[i], std::min(tile_width, image_width), std::min(tile_height, image_height),
+                          own_x0[j], own_x1[j], own_y0[i], own_y1[i]};
+                run.tiles.push_back(t);
+            }
+        }
+
+        std::lock_guard<std::mutex> run_lock(tiler->run_mutex);
+        std::unique_ptr<float[]> dense;
+        ie_blob_t *dense_blob = nullptr;
+        if (!tiler->detection) {
+            tensor_desc_t desc = tiler->output_desc;
+            desc.layout = layout_e::NCHW;
+            desc.dims.dims[0] = 1;
+            desc.dims.dims[2] = run.dense_height = static_cast<size_t>(std::lround(image_height * tiler->scale_y));
+            desc.dims.dims[3] = run.dense_width = static_cast<size_t>(std::lround(image_width * tiler->scale_x));
+            status = ie_blob_make_memory(&desc, &dense_blob);
+            if (status == IEStatusCode::OK) {
+                status = ie_blob_get_buffer(dense_blob, &buffer);
+            }
+            if (status != IEStatusCode::OK) {
+                ie_blob_free(&dense_blob);
+                return status;
+            }
+            run.dense = static_cast<float *>(buffer.buffer);
+            memset(run.dense, 0, dimsSize(desc.dims) * sizeof(float));
+        }
+        tiler->run = &run;
+
+        size_t batch = input_desc.dims.dims[0];
+        size_t item_size = dimsSize(input_desc.dims) / batch * elementSize(input_desc.precision);
+        size_t failed = 0;
+        size_t inferences = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t next = 0; next < run.tiles.size() && status == IEStatusCode::OK; next += batch) {
+            tiler_slot *slot = static_cast<tiler_slot *>(tiler->pool.acquire());
+            failed += !succeeded(*slot);
+
+            // tiles fill the batch of the input, the items left over by the last inference are ignored in its output
+            slot->tiles.clear();
+            for (size_t item = 0; item < batch && next + item < run.tiles.size(); ++item) {
+                copyTile(run, run.tiles[next + item], input_desc, slot->input + item * item_size);
+                slot->tiles.push_back(next + item);
+            }
+            status = tiler->pool.start(slot);
+            if (status == IEStatusCode::OK) {
+                ++inferences;
+            }
+        }
+
+        failed += tiler->pool.waitIdle();
+        tiler->run = nullptr;
+        if (status == IEStatusCode::OK && failed) {
+            status = IEStatusCode::GENERAL_ERROR;
+        }
+        if (status != IEStatusCode::OK) {
+            ie_blob_free(&dense_blob);
+            return status;
+        }
+
+        std::vector<ie_tiler_detection_t> detections = run.detections;
+        if (tiler->config.nms_threshold < 1.0f) {
+            detections = suppress(run.detections, tiler->config.nms_threshold);
+        }
+        *result = ie_tiler_result_t{};
+        if (!detections.empty()) {
+            result->detections = new ie_tiler_detection_t[detections.size()];
+            std::copy(detections.begin(), detections.end(), result->detections);
+            result->num_detections = detections.size();
+        }
+        result->output = dense_blob;
+        result->num_tiles = run.tiles.size();
+        result->num_inferences = inferences;
+        result->duration_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_tiler_result_free(ie_tiler_result_t *result) {
+    if (result) {
+        delete[] result->detections;
+        result->detections = NULL;
+        result->num_detections = 0;
+        ie_blob_free(&result->output);
+    }
+}
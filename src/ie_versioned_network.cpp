@@ -0,0 +1,294 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <utility>
+#include <algorithm>
+#include <condition_variable>
+#include "ie_c_api.h"
+#include "ie_c_api_internal.h"
+
+namespace {
+
+/**
+ * @struct net_version
+ * @brief One loaded version of the model with its pool of infer requests.
+ */
+struct net_version {
+    size_t number = 0;
+    ie_executable_network_t *exe_network = nullptr;
+    std::vector<ie_infer_request_t *> requests;
+    std::vector<ie_infer_request_t *> idle;
+};
+
+void freeVersion(std::unique_ptr<net_version> &version) {
+    if (!version) {
+        return;
+    }
+    for (auto &request : version->requests) {
+        ie_infer_request_free(&request);
+    }
+    ie_exec_network_free(&version->exe_network);
+    version.reset();
+}
+
+}  // namespace
+
+/**
+ * @struct ie_versioned_network
+ * @brief The published version and the replaced versions which still have requests in flight.
+ */
+struct ie_versioned_network {
+    ie_core_t *core = nullptr;
+    std::string device_name;
+    owned_config config;
+    size_t num_requests = 1;
+
+    std::mutex mutex;
+    std::condition_variable request_cv;  // a request became idle or a version was published
+    std::condition_variable update_cv;   // an update finished
+    std::unique_ptr<net_version> current;
+    std::vector<std::unique_ptr<net_version>> retired;
+    size_t last_version = 0;
+
+    std::thread updater;
+    bool updating = false;
+    IEStatusCode update_status = IEStatusCode::OK;
+};
+
+namespace {
+
+IEStatusCode loadVersion(ie_versioned_network *vnet, const std::string &xml, const std::string &weights_file,
+        std::unique_ptr<net_version> &version) {
+    ie_network_t *network = nullptr;
+    IEStatusCode status = ie_core_read_network(vnet->core, xml.c_str(), weights_file.empty() ? NULL : weights_file.c_str(), &network);
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+
+    version.reset(new net_version);
+    status = ie_core_load_network(vnet->core, network, vnet->device_name.c_str(), vnet->config.list(), &version->exe_network);
+    ie_network_free(&network);
+    for (size_t i = 0; i < vnet->num_requests && status == IEStatusCode::OK; ++i) {
+        ie_infer_request_t *request = nullptr;
+        status = ie_exec_network_create_infer_request(version->exe_network, &request);
+        if (status == IEStatusCode::OK) {
+            version->requests.push_back(request);
+        }
+    }
+    // pay the first-inference cost on the requests of the version before it takes traffic
+    if (status == IEStatusCode::OK) {
+        status = ie_exec_network_warmup(version->exe_network, version->requests.data(), version->requests.size(), 1,
+                                        warmup_fill_e::WARMUP_FILL_RANDOM, NULL);
+    }
+    if (status != IEStatusCode::OK) {
+        freeVersion(version);
+        return status;
+    }
+
+    version->idle = version->requests;
+    return IEStatusCode::OK;
+}
+
+/**
+ *@brief makes `version` the current one. The previous version is returned to be freed when none of its requests is in use.
+ */
+std::unique_ptr<net_version> publish(ie_versioned_network *vnet, std::unique_ptr<net_version> version) {
+    version->number = ++vnet->last_version;
+    std::unique_ptr<net_version> previous = std::move(vnet->current);
+    vnet->current = std::move(version);
+    if (previous && previous->idle.size() != previous->requests.size()) {
+        vnet->retired.push_back(std::move(previous));
+    }
+    return previous;
+}
+
+void runUpdate(ie_versioned_network *vnet, std::string xml, std::string weights_file) {
+    std::unique_ptr<net_version> version;
+    IEStatusCode status = IEStatusCode::UNEXPECTED;
+    try {
+        status = loadVersion(vnet, xml, weights_file, version);
+    } catch (...) {
+    }
+
+    std::unique_ptr<net_version> previous;
+    {
+        std::lock_guard<std::mutex> lock(vnet->mutex);
+        if (status == IEStatusCode::OK) {
+            previous = publish(vnet, std::move(version));
+        }
+        vnet->update_status = status;
+        vnet->updating = false;
+        vnet->update_cv.notify_all();
+        if (status == IEStatusCode::OK) {
+            vnet->request_cv.notify_all();
+        }
+    }
+    freeVersion(previous);
+}
+
+}  // namespace
+
+IEStatusCode ie_versioned_network_create(ie_core_t *core, const char *xml, const char *weights_file, \
+        const char *device_name, const ie_config_t *config, size_t num_requests, ie_versioned_network_t **versioned_network) {
+    if (core == nullptr || xml == nullptr || device_name == nullptr || config == nullptr || versioned_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_versioned_network_t> vnet(new ie_versioned_network_t);
+        vnet->core = core;
+        vnet->device_name = device_name;
+        vnet->num_requests = std::max<size_t>(num_requests, 1);
+        vnet->config.assign(config);
+
+        std::unique_ptr<net_version> version;
+        IEStatusCode status = loadVersion(vnet.get(), xml, weights_file ? weights_file : "", version);
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+        publish(vnet.get(), std::move(version));
+        *versioned_network = vnet.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_versioned_network_free(ie_versioned_network_t **versioned_network) {
+    if (versioned_network == nullptr || *versioned_network == nullptr) {
+        return;
+    }
+
+    ie_versioned_network_t *vnet = *versioned_network;
+    if (vnet->updater.joinable()) {
+        vnet->updater.join();
+    }
+    freeVersion(vnet->current);
+    for (auto &version : vnet->retired) {
+        freeVersion(version);
+    }
+    delete vnet;
+    *versioned_network = NULL;
+}
+
+IEStatusCode ie_versioned_network_update(ie_versioned_network_t *versioned_network, const char *xml, const char *weights_file) {
+    if (versioned_network == nullptr || xml == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    // the previous updater has published its version and at most frees the replaced one. It is joined without
+    // the lock, so that acquiring and releasing requests do not wait for the teardown.
+    std::thread previous;
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::lock_guard<std::mutex> lock(versioned_network->mutex);
+        if (versioned_network->updating) {
+            return IEStatusCode::REQUEST_BUSY;
+        }
+        previous = std::move(versioned_network->updater);
+        versioned_network->updater = std::thread(runUpdate, versioned_network, std::string(xml),
+                                                 std::string(weights_file ? weights_file : ""));
+        versioned_network->updating = true;
+    } catch (...) {
+        status = IEStatusCode::UNEXPECTED;
+    }
+    if (previous.joinable()) {
+        previous.join();
+    }
+
+    return status;
+}
+
+IEStatusCode ie_versioned_network_wait_update(ie_versioned_network_t *versioned_network, const int64_t timeout) {
+    if (versioned_network == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_lock<std::mutex> lock(versioned_network->mutex);
+    auto done = [versioned_network] { return !versioned_network->updating; };
+    if (timeout < 0) {
+        versioned_network->update_cv.wait(lock, done);
+    } else if (!versioned_network->update_cv.wait_for(lock, std::chrono::milliseconds(timeout), done)) {
+        return IEStatusCode::RESULT_NOT_READY;
+    }
+
+    return versioned_network->update_status;
+}
+
+IEStatusCode ie_versioned_network_get_version(ie_versioned_network_t *versioned_network, size_t *version) {
+    if (versioned_network == nullptr || version == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(versioned_network->mutex);
+    *version = versioned_network->current->number;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_versioned_network_acquire_request(ie_versioned_network_t *versioned_network, const int64_t timeout, \
+        ie_infer_request_t **request, size_t *version) {
+    if (versioned_network == nullptr || request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_lock<std::mutex> lock(versioned_network->mutex);
+    // re-evaluated after every wake up, so a waiter moves to a version published while it waited
+    auto available = [versioned_network] { return !versioned_network->current->idle.empty(); };
+    if (timeout < 0) {
+        versioned_network->request_cv.wait(lock, available);
+    } else if (!versioned_network->request_cv.wait_for(lock, std::chrono::milliseconds(timeout), available)) {
+        return IEStatusCode::REQUEST_BUSY;
+    }
+
+    net_version &current = *versioned_network->current;
+    *request = current.idle.back();
+    current.idle.pop_back();
+    if (version) {
+        *version = current.number;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_versioned_network_release_request(ie_versioned_network_t *versioned_network, ie_infer_request_t *request) {
+    if (versioned_network == nullptr || request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_ptr<net_version> drained;
+    {
+        std::lock_guard<std::mutex> lock(versioned_network->mutex);
+        net_version *current = versioned_network->current.get();
+        if (std::find(current->requests.begin(), current->requests.end(), request) != current->requests.end()) {
+            current->idle.push_back(request);
+            versioned_network->request_cv.notify_one();
+            return IEStatusCode::OK;
+        }
+
+        // a request of a replaced version, free that version with its last request
+        auto retired = std::find_if(versioned_network->retired.begin(), versioned_network->retired.end(),
+            [request](const std::unique_ptr<net_version> &v) {
+                return std::find(v->requests.begin(), v->requests.end(), request) != v->requests.end();
+            });
+        if (retired == versioned_network->retired.end()) {
+            return IEStatusCode::NOT_FOUND;
+        }
+        (*retired)->idle.push_back(request);
+        if ((*retired)->idle.size() == (*retired)->requests.size()) {
+            drained = std::move(*retired);
+            versioned_network->retired.erase(retired);
+        }
+    }
+    freeVersion(drained);
+
+    return IEStatusCode::OK;
+}